@@ -4,5 +4,53 @@
 
 #include "Logging/LogMacros.h"
 
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Containers/Array.h"
+#include "IGRanges/Impl/Parallel.h"
+#endif
+
 DECLARE_LOG_CATEGORY_EXTERN(LogIGRanges, Log, All);
 DECLARE_LOG_CATEGORY_EXTERN(LogIGRangesTests, Log, All);
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace IG::Ranges::Tests
+{
+/**
+ * Tiny chunks so that even small test ranges are split across several tasks.
+ */
+inline constexpr FParallelOptions ManyTasks = {.MaxTasks = 8, .MinElementsPerTask = 1};
+
+/**
+ * Invokes `Body(MaxTasks, Options)` with tiny chunks & several different numbers of tasks, so that parallel results can
+ * be compared with their serial counterparts no matter how the range is split.
+ */
+template <typename BodyType>
+void ForEachTaskCount(const BodyType& Body)
+{
+	for (const int32 MaxTasks : {1, 2, 3, 8, 64})
+	{
+		Body(MaxTasks, FParallelOptions{.MaxTasks = MaxTasks, .MinElementsPerTask = 1});
+	}
+}
+
+/**
+ * Gets 1000 values in [0, 13) that repeat in an unsorted pattern, for the parallel specs to split into chunks.
+ */
+[[nodiscard]] inline const TArray<int32>& GetParallelTestValues()
+{
+	static const TArray<int32> Values = [] {
+		TArray<int32> Result;
+		for (int32 i = 0; i < 1000; ++i)
+		{
+			Result.Emplace((i * 7) % 13);
+		}
+		return Result;
+	}();
+
+	return Values;
+}
+
+} // namespace IG::Ranges::Tests
+
+#endif // WITH_DEV_AUTOMATION_TESTS
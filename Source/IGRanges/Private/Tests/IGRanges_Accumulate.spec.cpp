@@ -1,8 +1,11 @@
 ﻿// Copyright Ian Good
 
 #include "IGRanges/Accumulate.h"
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/Select.h"
 #include "IGRangesInternal.h"
 #include "Misc/AutomationTest.h"
+#include <functional>
 #include <numeric>
 #include <ranges>
 
@@ -43,6 +46,28 @@ void FIGRangesAccumulateSpec::Define()
 		const FString ActualAccumulate = SomeValues | Accumulate(Seed, Fold);
 		TestEqual("accumulate", ActualAccumulate, ExpectedAccumulate);
 	});
+
+	// Views of temporary containers own them, so they can't be copied.
+	It("move_only_view", [this]() {
+		const auto MakeArray = []() {
+			return TArray<int32>({1, 2, 3, 4, 5});
+		};
+
+		const auto Double = [](int32 X) {
+			return X * 2;
+		};
+
+		const int32 SomeValues[] = {2, 4, 6, 8, 10};
+		const FString ExpectedAccumulate = std::accumulate(SomeValues, SomeValues + UE_ARRAY_COUNT(SomeValues), Seed, Fold);
+		const FString ActualAccumulate = MakeArray() | Select(Double) | Accumulate(Seed, Fold);
+		TestEqual("accumulate", ActualAccumulate, ExpectedAccumulate);
+	});
+
+	// `TSet` ends with a sentinel rather than an iterator.
+	It("set", [this]() {
+		const TSet<int32> SomeValues = {1, 2, 3, 4, 5};
+		TestEqual("accumulate", SomeValues | Accumulate(0, std::plus<>()), 15);
+	});
 }
 
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,64 @@
+﻿// Copyright Ian Good
+
+#include "Containers/Set.h"
+#include "IGRanges/AppendTo.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include <ranges>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesAppendToSpec, "IG.Ranges.AppendTo", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesAppendToSpec::Define()
+{
+	using namespace IG::Ranges;
+
+	static constexpr int32 SomeValues[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+	static constexpr int32 NumSomeValues = UE_ARRAY_COUNT(SomeValues);
+
+	// `AppendTo` with an empty range leaves the container unchanged.
+	It("empty", [this]() {
+		TArray<int32> TestMe = {-1, -2};
+		const TArray<int32>& Result = std::ranges::empty_view<int32>() | AppendTo(TestMe);
+		TestEqual("contents", Result, TArray<int32>{-1, -2});
+	});
+
+	// `AppendTo` adds elements after the existing ones & reserves space for sized ranges.
+	It("array", [this]() {
+		TArray<int32> ExpectedArray = {-1, -2};
+		ExpectedArray.Append(SomeValues);
+
+		TArray<int32> TestMe = {-1, -2};
+		TArray<int32>& Result = SomeValues | AppendTo(TestMe);
+		TestTrue("result", &Result == &TestMe);
+		TestEqual("contents", TestMe, ExpectedArray);
+		TestEqual("capacity", TestMe.Max(), 2 + NumSomeValues);
+	});
+
+	// `AppendTo` adds elements of unsized ranges.
+	It("array_filtered", [this]() {
+		const auto IsEven = [](auto&& x) {
+			return x % 2 == 0;
+		};
+
+		TArray<int32> TestMe = {-1};
+		const TArray<int32>& Result = SomeValues | std::views::filter(IsEven) | AppendTo(TestMe, ReserveExact);
+		TestEqual("contents", Result, TArray<int32>{-1, 2, 4, 6, 8, 10});
+		TestEqual("capacity", TestMe.Max(), 6);
+	});
+
+	// `AppendTo` works with sets too.
+	It("set", [this]() {
+		TSet<int32> TestMe = {1, 100};
+		const TSet<int32>& Result = SomeValues | AppendTo(TestMe);
+		TestEqual("count", Result.Num(), NumSomeValues + 1);
+		TestTrue("contains existing", TestMe.Contains(100));
+		for (const int32 X : SomeValues)
+		{
+			TestTrue("contains new", TestMe.Contains(X));
+		}
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,181 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/AsParallel.h"
+#include "IGRanges/Cast.h"
+#include "IGRanges/Chunk.h"
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/Distinct.h"
+#include "IGRanges/NonNull.h"
+#include "IGRanges/OfType.h"
+#include "IGRanges/OrderBy.h"
+#include "IGRanges/Select.h"
+#include "IGRanges/Skip.h"
+#include "IGRanges/Take.h"
+#include "IGRanges/Where.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/MetaData.h"
+#include "UObject/Package.h"
+#include <ranges>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesAsParallelSpec, "IG.Ranges.AsParallel", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesAsParallelSpec::Define()
+{
+	using namespace IG::Ranges;
+	using namespace IG::Ranges::Tests;
+
+	static const TArray<int32>& SomeValues = GetParallelTestValues();
+
+	static const auto IsEven = [](int32 X) {
+		return X % 2 == 0;
+	};
+
+	static const auto Square = [](int32 X) {
+		return static_cast<int64>(X) * X;
+	};
+
+	// Pointer-like elements (including nulls) for the adaptors that test each element's type or null-ness.
+	static const TArray<const UObject*> SomeObjects = [] {
+		const UObject* Objects[] = {nullptr, GetDefault<UObject>(), GetDefault<UClass>(), GetDefault<UPackage>(), GetDefault<UMetaData>()};
+
+		TArray<const UObject*> Result;
+		for (const int32 Value : SomeValues)
+		{
+			Result.Emplace(Objects[Value % UE_ARRAY_COUNT(Objects)]);
+		}
+		return Result;
+	}();
+
+	It("empty", [this]() {
+		const TArray<int32> Empty;
+		TestEqual("to_array", (Empty | AsParallel(ManyTasks) | Where(IsEven) | ToArray()).Num(), 0);
+		TestEqual("count", Empty | AsParallel(ManyTasks) | Where(IsEven) | Count(), 0);
+		TestEqual("sum", Empty | AsParallel(ManyTasks) | Select(Square) | Sum(), int64{});
+		TestTrue("all", Empty | AsParallel(ManyTasks) | All(IsEven));
+		TestFalse("any", Empty | AsParallel(ManyTasks) | Any(IsEven));
+		TestTrue("none", Empty | AsParallel(ManyTasks) | None(IsEven));
+		TestEqual("first_or_default", Empty | AsParallel(ManyTasks) | Where(IsEven) | FirstOrDefault(), 0);
+	});
+
+	// Parallel results match their serial counterparts regardless of how many tasks are used.
+	It("many", [this]() {
+		const TArray<int64> ExpectedArray = SomeValues | Where(IsEven) | Select(Square) | ToArray();
+		const int32 ExpectedCount = SomeValues | Where(IsEven) | Count();
+		const int64 ExpectedSum = SomeValues | Where(IsEven) | Select(Square) | Sum();
+
+		ForEachTaskCount([&](int32 MaxTasks, const FParallelOptions& Options) {
+			TestEqual(FString::Printf(TEXT("to_array (%d tasks)"), MaxTasks), SomeValues | AsParallel(Options) | Where(IsEven) | Select(Square) | ToArray(), ExpectedArray);
+			TestEqual(FString::Printf(TEXT("count (%d tasks)"), MaxTasks), SomeValues | AsParallel(Options) | Where(IsEven) | Count(), ExpectedCount);
+			TestEqual(FString::Printf(TEXT("count_if (%d tasks)"), MaxTasks), SomeValues | AsParallel(Options) | Count(IsEven), ExpectedCount);
+			TestEqual(FString::Printf(TEXT("sum (%d tasks)"), MaxTasks), SomeValues | AsParallel(Options) | Where(IsEven) | Select(Square) | Sum(), ExpectedSum);
+			TestEqual(FString::Printf(TEXT("sum_by (%d tasks)"), MaxTasks), SomeValues | AsParallel(Options) | Where(IsEven) | Sum(Square), ExpectedSum);
+		});
+	});
+
+	It("all_any_none", [this]() {
+		ForEachTaskCount([&](int32 MaxTasks, const FParallelOptions& Options) {
+			TestTrue(FString::Printf(TEXT("all (%d tasks)"), MaxTasks), SomeValues | AsParallel(Options) | Where(IsEven) | All(IsEven));
+			TestFalse(FString::Printf(TEXT("not all (%d tasks)"), MaxTasks), SomeValues | AsParallel(Options) | All(IsEven));
+			TestTrue(FString::Printf(TEXT("any (%d tasks)"), MaxTasks), SomeValues | AsParallel(Options) | Any(IsEven));
+			TestFalse(FString::Printf(TEXT("not any (%d tasks)"), MaxTasks), SomeValues | AsParallel(Options) | Where(IsEven) | Any([](int32 X) { return X % 2 == 1; }));
+			TestTrue(FString::Printf(TEXT("none (%d tasks)"), MaxTasks), SomeValues | AsParallel(Options) | None([](int32 X) { return X < 0; }));
+			TestFalse(FString::Printf(TEXT("not none (%d tasks)"), MaxTasks), SomeValues | AsParallel(Options) | None(IsEven));
+		});
+	});
+
+	It("pointers", [this]() {
+		const auto IsStruct = [](const UObject* Obj) {
+			return Obj->IsA<UStruct>();
+		};
+
+		const auto ToPointer = [](const UObject& Obj) {
+			return &Obj;
+		};
+
+		const TArray<const UMetaData*> ExpectedOfType = SomeObjects | OfType<const UMetaData>() | ToArray();
+		const TArray<const UField*> ExpectedCast = SomeObjects | IG::Ranges::Cast<const UField>() | ToArray();
+		const TArray<const UObject*> ExpectedNonNull = SomeObjects | NonNull() | ToArray();
+		const TArray<const UObject*> ExpectedSafeWhere = SomeObjects | SafeWhere(IsStruct) | ToArray();
+
+		ForEachTaskCount([&](int32 MaxTasks, const FParallelOptions& Options) {
+			TestEqual(FString::Printf(TEXT("of_type (%d tasks)"), MaxTasks), SomeObjects | AsParallel(Options) | OfType<const UMetaData>() | ToArray(), ExpectedOfType);
+			TestEqual(FString::Printf(TEXT("of_type_ref (%d tasks)"), MaxTasks), SomeObjects | AsParallel(Options) | OfTypeRef<const UMetaData>() | Count(), ExpectedOfType.Num());
+			TestEqual(FString::Printf(TEXT("cast (%d tasks)"), MaxTasks), SomeObjects | AsParallel(Options) | IG::Ranges::Cast<const UField>() | ToArray(), ExpectedCast);
+			TestEqual(FString::Printf(TEXT("non_null (%d tasks)"), MaxTasks), SomeObjects | AsParallel(Options) | NonNull() | ToArray(), ExpectedNonNull);
+			TestEqual(FString::Printf(TEXT("non_null_ref (%d tasks)"), MaxTasks), SomeObjects | AsParallel(Options) | NonNullRef() | Select(ToPointer) | ToArray(), ExpectedNonNull);
+			TestEqual(FString::Printf(TEXT("safe_where (%d tasks)"), MaxTasks), SomeObjects | AsParallel(Options) | SafeWhere(IsStruct) | ToArray(), ExpectedSafeWhere);
+		});
+	});
+
+	// Adaptors that depend on the elements around each element would only be applied within each chunk, so they're
+	// rejected at compile time.
+	It("unsupported_adaptors", [this]() {
+		using QueryType = decltype(SomeValues | AsParallel());
+		static_assert(Private::ParallelQueryAdaptor<QueryType, decltype(Where(IsEven))>);
+		static_assert(Private::ParallelQueryAdaptor<QueryType, decltype(Select(Square))>);
+		static_assert(!Private::ParallelQueryAdaptor<QueryType, decltype(Take(3))>);
+		static_assert(!Private::ParallelQueryAdaptor<QueryType, decltype(Skip(3))>);
+		static_assert(!Private::ParallelQueryAdaptor<QueryType, decltype(TakeWhile(IsEven))>);
+		static_assert(!Private::ParallelQueryAdaptor<QueryType, decltype(SkipWhile(IsEven))>);
+		static_assert(!Private::ParallelQueryAdaptor<QueryType, decltype(Distinct())>);
+		static_assert(!Private::ParallelQueryAdaptor<QueryType, decltype(OrderBy(Square))>);
+		static_assert(!Private::ParallelQueryAdaptor<QueryType, decltype(Chunk(3))>);
+
+		// Also after another adaptor, where the chunks are no longer contiguous.
+		using FilteredQueryType = decltype(SomeValues | AsParallel() | Where(IsEven));
+		static_assert(Private::ParallelQueryAdaptor<FilteredQueryType, decltype(Select(Square))>);
+		static_assert(!Private::ParallelQueryAdaptor<FilteredQueryType, decltype(Take(3))>);
+		static_assert(!Private::ParallelQueryAdaptor<FilteredQueryType, decltype(Skip(3))>);
+		static_assert(!Private::ParallelQueryAdaptor<FilteredQueryType, decltype(Distinct())>);
+	});
+
+	// Ordered queries return the first element in source order, no matter which task finds one first.
+	It("first_or_default", [this]() {
+		TArray<int32> Indices;
+		for (int32 i = 0; i < 1000; ++i)
+		{
+			Indices.Emplace(i);
+		}
+
+		// Matches in every chunk, so tasks race to publish theirs.
+		const auto IsMultipleOf37 = [](int32 X) {
+			return X > 0 && X % 37 == 0;
+		};
+
+		ForEachTaskCount([&](int32 MaxTasks, const FParallelOptions& Options) {
+			TestEqual(FString::Printf(TEXT("ordered (%d tasks)"), MaxTasks), Indices | AsParallel(Options) | Where(IsMultipleOf37) | FirstOrDefault(), 37);
+
+			const int32 Unordered = Indices | AsParallel(Options) | AsUnordered() | Where(IsMultipleOf37) | FirstOrDefault();
+			TestTrue(FString::Printf(TEXT("unordered (%d tasks)"), MaxTasks), IsMultipleOf37(Unordered));
+		});
+	});
+
+	It("unordered_to_array", [this]() {
+		TArray<int64> Expected = SomeValues | Where(IsEven) | Select(Square) | ToArray();
+		TArray<int64> Actual = SomeValues | AsParallel(ManyTasks) | AsUnordered() | Where(IsEven) | Select(Square) | ToArray();
+
+		// Same elements, in any order.
+		Expected.Sort();
+		Actual.Sort();
+		TestEqual("result", Actual, Expected);
+	});
+
+	It("as_ordered", [this]() {
+		const TArray<int32> Expected = SomeValues | Where(IsEven) | ToArray();
+		TestEqual("result", SomeValues | AsParallel(ManyTasks) | AsUnordered() | AsOrdered() | Where(IsEven) | ToArray(), Expected);
+	});
+
+	It("with_degree_of_parallelism", [this]() {
+		const TArray<int32> Expected = SomeValues | Where(IsEven) | ToArray();
+		for (const int32 Degree : {1, 2, 3, 8, 64})
+		{
+			const FParallelOptions Options = {.MinElementsPerTask = 1};
+			TestEqual(FString::Printf(TEXT("result (%d tasks)"), Degree), SomeValues | AsParallel(Options) | WithDegreeOfParallelism(Degree) | Where(IsEven) | ToArray(), Expected);
+		}
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,583 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges.h"
+#include "IGRangesInternal.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProperties.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/MetaData.h"
+#include "UObject/Package.h"
+#include <type_traits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Times every adapter & terminal against an equivalent hand-written loop over input sizes from 1e2 to 1e7 elements.
+ *
+ * Results are logged & written to `BenchmarkSuite.csv` & `BenchmarkSuite.json` in `Saved/IGRanges/` (or the directory
+ * given by `-IGRangesBenchmarkDir=`) so that they can be collected by build machines & compared between releases.
+ * Times are reported as nanoseconds per input element; `Relative` is the IGRanges time divided by the baseline time.
+ */
+BEGIN_DEFINE_SPEC(FIGRangesBenchmarkSuiteSpec, "IG.Ranges.BenchmarkSuite", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/**
+ * The timings of one case at one input size.
+ */
+struct FResult
+{
+	FString Case;
+	int32 Num = 0;
+	double BaselineNsPerElement = 0.0;
+	double IGRangesNsPerElement = 0.0;
+};
+
+TArray<FResult> Results;
+
+// Every result is folded into this so that the timed calls can't be optimized away.
+volatile int64 Sink = 0;
+
+/**
+ * Reduces a case's result to a number that is compared between the baseline & IGRanges versions.
+ */
+template <typename T>
+static int64 Checksum(const T& Result)
+{
+	if constexpr (requires { Result.Num(); })
+	{
+		return Result.Num();
+	}
+	else if constexpr (std::is_pointer_v<T>)
+	{
+		return static_cast<int64>(reinterpret_cast<UPTRINT>(Result));
+	}
+	else
+	{
+		return static_cast<int64>(Result);
+	}
+}
+
+static TArray<const UObject*> MakeObjects(int32 Num)
+{
+	const UObject* ObjectCDO = GetDefault<UObject>();
+	const UObject* ClassCDO = GetDefault<UClass>();
+	const UObject* PackageCDO = GetDefault<UPackage>();
+	const UObject* MetaDataCDO = GetDefault<UMetaData>();
+
+	const UObject* SomeObjects[] = {
+		ObjectCDO,
+		ClassCDO,
+		PackageCDO,
+		MetaDataCDO,
+		nullptr,
+		ObjectCDO->GetClass(),
+		ClassCDO->GetClass(),
+		PackageCDO->GetClass(),
+		MetaDataCDO->GetClass(),
+		nullptr,
+		ObjectCDO->GetPackage(),
+		ClassCDO->GetPackage(),
+		PackageCDO->GetPackage(),
+		MetaDataCDO->GetPackage(),
+		nullptr,
+	};
+
+	TArray<const UObject*> Objects;
+	Objects.Reserve(Num);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Objects.Emplace(SomeObjects[i % UE_ARRAY_COUNT(SomeObjects)]);
+	}
+
+	return Objects;
+}
+
+static TArray<const UClass*> MakeClasses(int32 Num)
+{
+	const UClass* SomeClasses[] = {
+		UObject::StaticClass(),
+		UClass::StaticClass(),
+		UPackage::StaticClass(),
+		UMetaData::StaticClass(),
+		nullptr,
+	};
+
+	TArray<const UClass*> Classes;
+	Classes.Reserve(Num);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Classes.Emplace(SomeClasses[i % UE_ARRAY_COUNT(SomeClasses)]);
+	}
+
+	return Classes;
+}
+
+/**
+ * Returns the median time (in seconds) of one call of `Func`.
+ * Each sample calls `Func` enough times to take a measurable amount of time, even for the smallest inputs.
+ */
+template <typename FuncType, typename InputType>
+double MeasureSeconds(const FuncType& Func, const InputType& Input)
+{
+	constexpr int32 NumSamples = 7;
+	constexpr double MinSampleSeconds = 0.002;
+	constexpr int32 MaxCallsPerSample = 1 << 20;
+
+	int32 NumCalls = 1;
+	for (;;)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumCalls; ++i)
+		{
+			Sink = Sink + Checksum(Func(Input));
+		}
+
+		if (FPlatformTime::Seconds() - StartTime >= MinSampleSeconds || NumCalls >= MaxCallsPerSample)
+		{
+			break;
+		}
+
+		NumCalls *= 2;
+	}
+
+	TArray<double> Samples;
+	for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumCalls; ++i)
+		{
+			Sink = Sink + Checksum(Func(Input));
+		}
+
+		Samples.Emplace((FPlatformTime::Seconds() - StartTime) / NumCalls);
+	}
+
+	Samples.Sort();
+	return Samples[NumSamples / 2];
+}
+
+/**
+ * Times a case at every input size, then rewrites the output files with the results so far.
+ * `MakeInput` creates the input for a given number of elements; `BaselineVersion` & `IGRangesVersion` are called with it.
+ */
+template <typename MakeInputType, typename BaselineType, typename IGRangesType>
+void RunCase(const TCHAR* Case, const MakeInputType& MakeInput, const BaselineType& BaselineVersion, const IGRangesType& IGRangesVersion)
+{
+	static constexpr int32 Sizes[] = {100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000};
+
+	// Running a case again (e.g. in the same editor session) replaces its previous results.
+	Results.RemoveAll([Case](const FResult& Result) { return Result.Case == Case; });
+
+	for (const int32 Num : Sizes)
+	{
+		const auto Input = MakeInput(Num);
+
+		// Sanity check that these versions produce the same results.
+		const int64 Expected = Checksum(BaselineVersion(Input));
+		const int64 Actual = Checksum(IGRangesVersion(Input));
+		if (!TestEqual(*FString::Printf(TEXT("%s igr version results (%d elements)"), Case, Num), Actual, Expected))
+		{
+			return;
+		}
+
+		FResult& Result = Results.Emplace_GetRef();
+		Result.Case = Case;
+		Result.Num = Num;
+		Result.BaselineNsPerElement = MeasureSeconds(BaselineVersion, Input) * 1e9 / Num;
+		Result.IGRangesNsPerElement = MeasureSeconds(IGRangesVersion, Input) * 1e9 / Num;
+
+		UE_LOG(LogIGRangesTests, Log, TEXT("%s Num=%d Baseline=%.3fns IGRanges=%.3fns Relative=%.3f"), Case, Num, Result.BaselineNsPerElement, Result.IGRangesNsPerElement, Result.IGRangesNsPerElement / Result.BaselineNsPerElement);
+	}
+
+	WriteResults();
+}
+
+void WriteResults() const
+{
+	FString OutputDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("IGRanges"));
+	FParse::Value(FCommandLine::Get(), TEXT("IGRangesBenchmarkDir="), OutputDir);
+
+	FString Csv = TEXT("Case,Num,BaselineNsPerElement,IGRangesNsPerElement,Relative\n");
+	for (const FResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%s,%d,%.4f,%.4f,%.4f\n"), *Result.Case, Result.Num, Result.BaselineNsPerElement, Result.IGRangesNsPerElement, Result.IGRangesNsPerElement / Result.BaselineNsPerElement);
+	}
+
+	FString Json = TEXT("{\n");
+	Json += FString::Printf(TEXT("\t\"engine\": \"%s\",\n"), *FEngineVersion::Current().ToString().ReplaceCharWithEscapedChar());
+	Json += FString::Printf(TEXT("\t\"platform\": \"%s\",\n"), ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+	Json += FString::Printf(TEXT("\t\"configuration\": \"%s\",\n"), LexToString(FApp::GetBuildConfiguration()));
+	Json += FString::Printf(TEXT("\t\"cpu\": \"%s\",\n"), *FPlatformMisc::GetCPUBrand().TrimStartAndEnd().ReplaceCharWithEscapedChar());
+	Json += FString::Printf(TEXT("\t\"timestamp\": \"%s\",\n"), *FDateTime::UtcNow().ToIso8601());
+	Json += TEXT("\t\"results\": [\n");
+	for (int32 i = 0; i < Results.Num(); ++i)
+	{
+		const FResult& Result = Results[i];
+		Json += FString::Printf(
+			TEXT("\t\t{\"case\": \"%s\", \"num\": %d, \"baselineNsPerElement\": %.4f, \"igrangesNsPerElement\": %.4f, \"relative\": %.4f}%s\n"),
+			*Result.Case,
+			Result.Num,
+			Result.BaselineNsPerElement,
+			Result.IGRangesNsPerElement,
+			Result.IGRangesNsPerElement / Result.BaselineNsPerElement,
+			(i + 1 < Results.Num()) ? TEXT(",") : TEXT(""));
+	}
+	Json += TEXT("\t]\n}\n");
+
+	const FString CsvPath = FPaths::Combine(OutputDir, TEXT("BenchmarkSuite.csv"));
+	const FString JsonPath = FPaths::Combine(OutputDir, TEXT("BenchmarkSuite.json"));
+	if (FFileHelper::SaveStringToFile(Csv, *CsvPath) && FFileHelper::SaveStringToFile(Json, *JsonPath))
+	{
+		UE_LOG(LogIGRangesTests, Log, TEXT("Benchmark results were written to %s & %s"), *CsvPath, *JsonPath);
+	}
+	else
+	{
+		UE_LOG(LogIGRangesTests, Warning, TEXT("Failed to write benchmark results to %s"), *OutputDir);
+	}
+}
+
+END_DEFINE_SPEC(FIGRangesBenchmarkSuiteSpec)
+
+void FIGRangesBenchmarkSuiteSpec::Define()
+{
+	const auto IsCDO = [](const UObject* Obj) {
+		return Obj != nullptr && Obj->HasAnyFlags(RF_ClassDefaultObject);
+	};
+
+	// Never true for the inputs, so searches have to visit every element.
+	const auto IsMissing = [](const UObject* Obj) {
+		return Obj == GetTransientPackage();
+	};
+
+	const auto IsNotMissing = [IsMissing](const UObject* Obj) {
+		return !IsMissing(Obj);
+	};
+
+	const auto GetClassSafe = [](const UObject* Obj) -> const UClass* {
+		return (Obj != nullptr) ? Obj->GetClass() : nullptr;
+	};
+
+	It("Where", [=, this]() {
+		RunCase(
+			TEXT("Where"),
+			MakeObjects,
+			[=](const TArray<const UObject*>& Input) {
+				UPTRINT Result = 0;
+				for (const UObject* Obj : Input)
+				{
+					if (IsCDO(Obj))
+					{
+						Result += reinterpret_cast<UPTRINT>(Obj);
+					}
+				}
+
+				return Result;
+			},
+			[=](const TArray<const UObject*>& Input) {
+				UPTRINT Result = 0;
+				for (const UObject* Obj : Input | Where(IsCDO))
+				{
+					Result += reinterpret_cast<UPTRINT>(Obj);
+				}
+
+				return Result;
+			});
+	});
+
+	It("Select", [=, this]() {
+		RunCase(
+			TEXT("Select"),
+			MakeObjects,
+			[=](const TArray<const UObject*>& Input) {
+				UPTRINT Result = 0;
+				for (const UObject* Obj : Input)
+				{
+					Result += reinterpret_cast<UPTRINT>(GetClassSafe(Obj));
+				}
+
+				return Result;
+			},
+			[=](const TArray<const UObject*>& Input) {
+				UPTRINT Result = 0;
+				for (const UClass* Class : Input | Select(GetClassSafe))
+				{
+					Result += reinterpret_cast<UPTRINT>(Class);
+				}
+
+				return Result;
+			});
+	});
+
+	It("Cast", [this]() {
+		RunCase(
+			TEXT("Cast"),
+			MakeObjects,
+			[](const TArray<const UObject*>& Input) {
+				UPTRINT Result = 0;
+				for (const UObject* Obj : Input)
+				{
+					Result += reinterpret_cast<UPTRINT>(::Cast<UClass>(Obj));
+				}
+
+				return Result;
+			},
+			[](const TArray<const UObject*>& Input) {
+				UPTRINT Result = 0;
+				for (const UClass* Class : Input | Cast<UClass>())
+				{
+					Result += reinterpret_cast<UPTRINT>(Class);
+				}
+
+				return Result;
+			});
+	});
+
+	It("OfType", [this]() {
+		RunCase(
+			TEXT("OfType"),
+			MakeObjects,
+			[](const TArray<const UObject*>& Input) {
+				UPTRINT Result = 0;
+				for (const UObject* Obj : Input)
+				{
+					if (const UClass* Class = ::Cast<UClass>(Obj))
+					{
+						Result += reinterpret_cast<UPTRINT>(Class);
+					}
+				}
+
+				return Result;
+			},
+			[](const TArray<const UObject*>& Input) {
+				UPTRINT Result = 0;
+				for (const UClass* Class : Input | OfType<UClass>())
+				{
+					Result += reinterpret_cast<UPTRINT>(Class);
+				}
+
+				return Result;
+			});
+	});
+
+	It("NonNull", [this]() {
+		RunCase(
+			TEXT("NonNull"),
+			MakeObjects,
+			[](const TArray<const UObject*>& Input) {
+				UPTRINT Result = 0;
+				for (const UObject* Obj : Input)
+				{
+					if (Obj != nullptr)
+					{
+						Result += reinterpret_cast<UPTRINT>(Obj);
+					}
+				}
+
+				return Result;
+			},
+			[](const TArray<const UObject*>& Input) {
+				UPTRINT Result = 0;
+				for (const UObject* Obj : Input | NonNull())
+				{
+					Result += reinterpret_cast<UPTRINT>(Obj);
+				}
+
+				return Result;
+			});
+	});
+
+	It("ToArray", [this]() {
+		RunCase(
+			TEXT("ToArray"),
+			MakeObjects,
+			[](const TArray<const UObject*>& Input) {
+				TArray<const UObject*> Result;
+				for (const UObject* Obj : Input)
+				{
+					if (Obj != nullptr)
+					{
+						Result.Emplace(Obj);
+					}
+				}
+
+				return Result;
+			},
+			[](const TArray<const UObject*>& Input) {
+				return Input | Where([](const UObject* Obj) { return Obj != nullptr; }) | ToArray();
+			});
+	});
+
+	It("ToSet", [this]() {
+		RunCase(
+			TEXT("ToSet"),
+			MakeObjects,
+			[](const TArray<const UObject*>& Input) {
+				TSet<const UObject*> Result;
+				for (const UObject* Obj : Input)
+				{
+					Result.Emplace(Obj);
+				}
+
+				return Result;
+			},
+			[](const TArray<const UObject*>& Input) {
+				return Input | ToSet();
+			});
+	});
+
+	It("FirstOrDefault", [=, this]() {
+		RunCase(
+			TEXT("FirstOrDefault"),
+			MakeObjects,
+			[=](const TArray<const UObject*>& Input) {
+				for (const UObject* Obj : Input)
+				{
+					if (IsMissing(Obj))
+					{
+						return Obj;
+					}
+				}
+
+				return static_cast<const UObject*>(nullptr);
+			},
+			[=](const TArray<const UObject*>& Input) {
+				return Input | FirstOrDefault(IsMissing);
+			});
+	});
+
+	It("All", [=, this]() {
+		RunCase(
+			TEXT("All"),
+			MakeObjects,
+			[=](const TArray<const UObject*>& Input) {
+				for (const UObject* Obj : Input)
+				{
+					if (!IsNotMissing(Obj))
+					{
+						return false;
+					}
+				}
+
+				return true;
+			},
+			[=](const TArray<const UObject*>& Input) {
+				return Input | All(IsNotMissing);
+			});
+	});
+
+	It("Any", [=, this]() {
+		RunCase(
+			TEXT("Any"),
+			MakeObjects,
+			[=](const TArray<const UObject*>& Input) {
+				for (const UObject* Obj : Input)
+				{
+					if (IsMissing(Obj))
+					{
+						return true;
+					}
+				}
+
+				return false;
+			},
+			[=](const TArray<const UObject*>& Input) {
+				return Input | Any(IsMissing);
+			});
+	});
+
+	It("None", [=, this]() {
+		RunCase(
+			TEXT("None"),
+			MakeObjects,
+			[=](const TArray<const UObject*>& Input) {
+				for (const UObject* Obj : Input)
+				{
+					if (IsMissing(Obj))
+					{
+						return false;
+					}
+				}
+
+				return true;
+			},
+			[=](const TArray<const UObject*>& Input) {
+				return Input | None(IsMissing);
+			});
+	});
+
+	It("Count", [=, this]() {
+		RunCase(
+			TEXT("Count"),
+			MakeObjects,
+			[=](const TArray<const UObject*>& Input) {
+				int32 Result = 0;
+				for (const UObject* Obj : Input)
+				{
+					if (IsCDO(Obj))
+					{
+						++Result;
+					}
+				}
+
+				return Result;
+			},
+			[=](const TArray<const UObject*>& Input) {
+				return Input | Count(IsCDO);
+			});
+	});
+
+	It("Sum", [this]() {
+		const auto GetId = [](const UObject* Obj) {
+			return (Obj != nullptr) ? static_cast<int64>(Obj->GetUniqueID()) : int64{0};
+		};
+
+		RunCase(
+			TEXT("Sum"),
+			MakeObjects,
+			[=](const TArray<const UObject*>& Input) {
+				int64 Result = 0;
+				for (const UObject* Obj : Input)
+				{
+					Result += GetId(Obj);
+				}
+
+				return Result;
+			},
+			[=](const TArray<const UObject*>& Input) {
+				return Input | Sum(GetId);
+			});
+	});
+
+	It("CDO", [this]() {
+		RunCase(
+			TEXT("CDO"),
+			MakeClasses,
+			[](const TArray<const UClass*>& Input) {
+				UPTRINT Result = 0;
+				for (const UClass* Class : Input)
+				{
+					Result += reinterpret_cast<UPTRINT>((Class != nullptr) ? Class->GetDefaultObject() : nullptr);
+				}
+
+				return Result;
+			},
+			[](const TArray<const UClass*>& Input) {
+				UPTRINT Result = 0;
+				for (const UObject* Obj : Input | Select(Selectors::CDO))
+				{
+					Result += reinterpret_cast<UPTRINT>(Obj);
+				}
+
+				return Result;
+			});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
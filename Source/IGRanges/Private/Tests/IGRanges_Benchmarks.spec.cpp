@@ -2,11 +2,22 @@
 
 #include "IGRanges.h"
 #include "IGRangesInternal.h"
+#include "Algo/Sort.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTLS.h"
+#include "Math/RandomStream.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/MemStack.h"
 #include "Tests/Benchmark.h"
 #include "UObject/MetaData.h"
 #include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <numeric>
+#include <ranges>
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -50,6 +61,206 @@ static TArray<const UObject*> MakeObjectsArray()
 	return SomeObjectsManyTimes;
 }
 
+/**
+ * Makes an array of objects of several classes where consecutive objects tend to share the same class (as in arrays of
+ * actors or components), with run lengths between 1 & `MaxRunLength`.
+ */
+static TArray<const UObject*> MakeObjectRunsArray(int32 MaxRunLength)
+{
+	const UObject* SomeObjects[] = {
+		GetDefault<UObject>(),
+		GetDefault<UClass>(),
+		GetDefault<UPackage>(),
+		GetDefault<UMetaData>(),
+		GetDefault<UEnum>(),
+		GetDefault<UScriptStruct>(),
+		GetDefault<UFunction>(),
+		UObject::StaticClass(),
+		UPackage::StaticClass(),
+		nullptr,
+	};
+
+	constexpr int32 NumElements = 7'500'000;
+
+	FRandomStream Rng(1234);
+	TArray<const UObject*> Runs;
+	Runs.Reserve(NumElements);
+	while (Runs.Num() < NumElements)
+	{
+		const UObject* Obj = SomeObjects[Rng.RandHelper(UE_ARRAY_COUNT(SomeObjects))];
+		const int32 RunLength = FMath::Min(Rng.RandRange(1, MaxRunLength), NumElements - Runs.Num());
+		for (int32 i = 0; i < RunLength; ++i)
+		{
+			Runs.Emplace(Obj);
+		}
+	}
+
+	return Runs;
+}
+
+/**
+ * Gets the task counts that parallel benchmarks are run with: 1, 2, 4, 8, etc. up to (& including) the number of
+ * task graph workers plus the calling thread.
+ */
+static TArray<int32> GetParallelTaskCounts()
+{
+	const int32 MaxTasks = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+
+	TArray<int32> TaskCounts;
+	for (int32 NumTasks = 1; NumTasks < MaxTasks; NumTasks *= 2)
+	{
+		TaskCounts.Emplace(NumTasks);
+	}
+
+	TaskCounts.Emplace(MaxTasks);
+	return TaskCounts;
+}
+
+/**
+ * Allocator that forwards to the global allocator while counting the heap allocations (including reallocations) made
+ * by one thread.
+ * Installed as `GMalloc` for the duration of `CountAllocations`; the instance itself is never destroyed because other
+ * threads may still be calling through it after it has been uninstalled.
+ */
+class FAllocationCounter final : public FMalloc
+{
+public:
+	template <typename FuncType>
+	static int64 CountAllocations(FuncType&& Func)
+	{
+		static FAllocationCounter* Instance = new FAllocationCounter();
+
+		Instance->Inner = GMalloc;
+		Instance->NumAllocations = 0;
+		Instance->CountingThreadId = FPlatformTLS::GetCurrentThreadId();
+		GMalloc = Instance;
+
+		Func();
+
+		GMalloc = Instance->Inner;
+		Instance->CountingThreadId = 0;
+		return Instance->NumAllocations;
+	}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		Track();
+		return Inner->Malloc(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		Track();
+		return Inner->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override
+	{
+		Inner->Free(Original);
+	}
+
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+	{
+		return Inner->QuantizeSize(Count, Alignment);
+	}
+
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+	{
+		return Inner->GetAllocationSize(Original, SizeOut);
+	}
+
+	virtual bool IsInternallyThreadSafe() const override
+	{
+		return Inner->IsInternallyThreadSafe();
+	}
+
+	virtual const TCHAR* GetDescriptiveName() override
+	{
+		return TEXT("IGRangesAllocationCounter");
+	}
+
+private:
+	void Track()
+	{
+		if (CountingThreadId.load(std::memory_order_relaxed) == FPlatformTLS::GetCurrentThreadId())
+		{
+			++NumAllocations;
+		}
+	}
+
+	FMalloc* Inner = nullptr;
+	std::atomic<uint32> CountingThreadId = 0;
+	int64 NumAllocations = 0;
+};
+
+/**
+ * Benchmarks `Sum` of a contiguous array against a plain loop with working sets that fit in the L1, L2, & L3 caches and
+ * one that has to be streamed from DRAM. Smaller arrays are summed repeatedly so that every size reads the same number of
+ * bytes per run.
+ * `MakeValue` should produce values whose sums are exact in any order (e.g. small integers that cancel out).
+ */
+template <typename T, typename MakeValueType>
+static void BenchmarkContiguousSum(FAutomationTestBase& Test, const TCHAR* TypeName, const MakeValueType& MakeValue)
+{
+	using namespace IG::Ranges;
+
+	constexpr int64 KiB = 1024;
+	constexpr int64 WorkingSetSizes[] = {16 * KiB, 256 * KiB, 8 * KiB * KiB, 256 * KiB * KiB};
+	constexpr int64 BytesPerRun = 256 * KiB * KiB;
+
+	for (const int64 WorkingSetSize : WorkingSetSizes)
+	{
+		const int32 Num = static_cast<int32>(WorkingSetSize / sizeof(T));
+		const int64 NumRepeats = BytesPerRun / WorkingSetSize;
+
+		TArray<T> Values;
+		Values.Reserve(Num);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Values.Emplace(MakeValue(i));
+		}
+
+		const auto BaselineVersion = [&]() {
+			T Result = T(0);
+			for (int64 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+			{
+				for (const T& Elem : Values)
+				{
+					Result += Elem;
+				}
+			}
+
+			return Result;
+		};
+
+		const auto IGRangesVersion = [&]() {
+			T Result = T(0);
+			for (int64 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+			{
+				Result += Values | Sum();
+			}
+
+			return Result;
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const T Expected = BaselineVersion();
+			const T Actual = IGRangesVersion();
+			if (!Test.TestEqual(*FString::Printf(TEXT("%s igr version results"), TypeName), Actual, Expected))
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d %s elements (%lld KiB) were summed %lld times."), Num, TypeName, WorkingSetSize / KiB, NumRepeats);
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+		UE_BENCHMARK(NumRuns, IGRangesVersion);
+	}
+}
+
 void FIGRangesBenchmarksSpec::Define()
 {
 	It("complex_chain", [this]() {
@@ -130,103 +341,1322 @@ void FIGRangesBenchmarksSpec::Define()
 		UE_BENCHMARK(NumRuns, IGRangesVersion);
 	});
 
-	It("accumulate", [this]() {
+	// `OfType` casts each element once, whereas `Cast | filter` casts surviving elements again when they're read.
+	It("of_type_chain", [this]() {
 		const TArray<const UObject*> MyObjects = MakeObjectsArray();
 
 		const auto BaselineVersion = [&]() {
-			uint64 Result = 0;
-			for (const UObject* Elem : MyObjects)
+			TArray<FName> Names;
+			for (const UObject* Obj : MyObjects)
 			{
-				Result += (Elem != nullptr) ? Elem->GetName().Len() : 0;
+				if (const UMetaData* MetaData = ::Cast<UMetaData>(Obj))
+				{
+					Names.Emplace(MetaData->GetFName());
+				}
 			}
 
-			return Result;
+			return Names;
 		};
 
-		const auto Fold = [](uint64 Acc, const UObject* Elem) {
-			return Acc + ((Elem != nullptr) ? Elem->GetName().Len() : 0);
+		const auto CastFilterVersion = [&]() {
+			return MyObjects
+				 | Cast<UMetaData>()
+				 | std::views::filter([](const UMetaData* MetaData) { return MetaData != nullptr; })
+				 | Select(&UMetaData::GetFName)
+				 | ToArray();
 		};
 
-		const auto StdVersion = [&]() {
-			return std::accumulate(MyObjects.begin(), MyObjects.end(), uint64{}, Fold);
+		const auto IGRangesVersion = [&]() {
+			return MyObjects
+				 | OfType<UMetaData>()
+				 | Select(&UMetaData::GetFName)
+				 | ToArray();
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const TArray<FName> ExpectedNames = BaselineVersion();
+			const TArray<FName> CastFilterNames = CastFilterVersion();
+			const TArray<FName> ActualNames = IGRangesVersion();
+			const bool bSuccess =
+				TestEqual("cast filter version results", CastFilterNames, ExpectedNames)
+				&& TestEqual("igr version results", ActualNames, ExpectedNames);
+			if (!bSuccess)
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements were filtered into %d elements."), MyObjects.Num(), ActualNames.Num());
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+		UE_BENCHMARK(NumRuns, CastFilterVersion);
+		UE_BENCHMARK(NumRuns, IGRangesVersion);
+	});
+
+	// An expensive projection followed by a filter: without `Memoize`, the projection is computed again for each element
+	// that passes the filter.
+	It("memoize", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		const auto GetPathLength = [](const UObject* Obj) {
+			return Obj->GetPathName().Len();
+		};
+
+		const auto IsLongPath = [](int32 Len) {
+			return Len > 20;
+		};
+
+		const auto BaselineVersion = [&]() {
+			int64 Total = 0;
+			for (const UObject* Obj : MyObjects)
+			{
+				if (Obj != nullptr)
+				{
+					const int32 Len = GetPathLength(Obj);
+					if (IsLongPath(Len))
+					{
+						Total += Len;
+					}
+				}
+			}
+
+			return Total;
+		};
+
+		const auto UnmemoizedVersion = [&]() {
+			return MyObjects
+				 | NonNull()
+				 | Select(GetPathLength)
+				 | Where(IsLongPath)
+				 | Sum([](int32 Len) { return static_cast<int64>(Len); });
 		};
 
 		const auto IGRangesVersion = [&]() {
-			return MyObjects | Accumulate(uint64{}, Fold);
+			return MyObjects
+				 | NonNull()
+				 | Select(GetPathLength)
+				 | Memoize()
+				 | Where(IsLongPath)
+				 | Sum([](int32 Len) { return static_cast<int64>(Len); });
 		};
 
 		// Sanity check that these versions produce the same results.
 		{
-			const int32 Expected = BaselineVersion();
-			const int32 StdActual = StdVersion();
-			const int32 IgrActual = IGRangesVersion();
+			const int64 ExpectedTotal = BaselineVersion();
+			const int64 UnmemoizedTotal = UnmemoizedVersion();
+			const int64 ActualTotal = IGRangesVersion();
 			const bool bSuccess =
-				TestEqual("std version results", StdActual, Expected)
-				&& TestEqual("igr version results", IgrActual, Expected);
+				TestEqual("unmemoized version results", UnmemoizedTotal, ExpectedTotal)
+				&& TestEqual("igr version results", ActualTotal, ExpectedTotal);
 			if (!bSuccess)
 			{
 				return;
 			}
 
-			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements were accumulated."), MyObjects.Num());
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements have a total path length of %lld."), MyObjects.Num(), ActualTotal);
 		}
 
 		constexpr int32 NumRuns = 7;
 		UE_BENCHMARK(NumRuns, BaselineVersion);
-		UE_BENCHMARK(NumRuns, StdVersion);
+		UE_BENCHMARK(NumRuns, UnmemoizedVersion);
 		UE_BENCHMARK(NumRuns, IGRangesVersion);
 	});
 
-	It("sum", [this]() {
-		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+	// Weak object pointers are looked up in the object array each time they're null-checked or resolved.
+	It("resolve_weak", [this]() {
+		TArray<TWeakObjectPtr<const UObject>> MyWeakObjects;
+		for (const UObject* Obj : MakeObjectsArray())
+		{
+			MyWeakObjects.Emplace(Obj);
+		}
 
 		const auto BaselineVersion = [&]() {
-			int32 Result = 0;
-			for (const UObject* Elem : MyObjects)
+			int32 NumMetaData = 0;
+			for (const TWeakObjectPtr<const UObject>& WeakObj : MyWeakObjects)
 			{
-				Result += (Elem != nullptr) ? Elem->GetName().Len() : 0;
+				if (::Cast<UMetaData>(WeakObj.Get()) != nullptr)
+				{
+					++NumMetaData;
+				}
 			}
 
-			return Result;
+			return NumMetaData;
 		};
 
-		const auto Fold = [](int32 Acc, const UObject* Elem) {
-			return Acc + ((Elem != nullptr) ? Elem->GetName().Len() : 0);
+		const auto UnresolvedVersion = [&]() {
+			return MyWeakObjects
+				 | NonNull()
+				 | Select([](const TWeakObjectPtr<const UObject>& WeakObj) { return WeakObj.Get(); })
+				 | OfType<UMetaData>()
+				 | Count();
 		};
 
-		const auto StdVersion = [&]() {
-			return std::accumulate(MyObjects.begin(), MyObjects.end(), int32{}, Fold);
+		const auto IGRangesVersion = [&]() {
+			return MyWeakObjects
+				 | ResolveWeak()
+				 | OfType<UMetaData>()
+				 | Count();
 		};
 
-		const auto SumSelector = [](const UObject* Elem) {
-			return (Elem != nullptr) ? Elem->GetName().Len() : 0;
+		// Sanity check that these versions produce the same results.
+		{
+			const int32 ExpectedCount = BaselineVersion();
+			const int32 UnresolvedCount = UnresolvedVersion();
+			const int32 ActualCount = IGRangesVersion();
+			const bool bSuccess =
+				TestEqual("unresolved version results", UnresolvedCount, ExpectedCount)
+				&& TestEqual("igr version results", ActualCount, ExpectedCount);
+			if (!bSuccess)
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d weak elements were filtered into %d elements."), MyWeakObjects.Num(), ActualCount);
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+		UE_BENCHMARK(NumRuns, UnresolvedVersion);
+		UE_BENCHMARK(NumRuns, IGRangesVersion);
+	});
+
+	// Every loaded class many times over in random order, tested against several bases.
+	It("is_child_of_any", [this]() {
+		TArray<UClass*> AllClasses;
+		GetDerivedClasses(UObject::StaticClass(), AllClasses);
+
+		constexpr int32 NumElements = 5'000'000;
+
+		FRandomStream Rng(1234);
+		TArray<const UClass*> MyClasses;
+		MyClasses.Reserve(NumElements);
+		for (int32 i = 0; i < NumElements; ++i)
+		{
+			MyClasses.Emplace(AllClasses[Rng.RandHelper(AllClasses.Num())]);
+		}
+
+		const UClass* const Bases[] = {UEnum::StaticClass(), UScriptStruct::StaticClass(), UFunction::StaticClass(), UPackage::StaticClass()};
+
+		const auto BaselineVersion = [&]() {
+			int32 NumChildren = 0;
+			for (const UClass* Class : MyClasses)
+			{
+				if (Class->IsChildOf(Bases[0]) || Class->IsChildOf(Bases[1]) || Class->IsChildOf(Bases[2]) || Class->IsChildOf(Bases[3]))
+				{
+					++NumChildren;
+				}
+			}
+
+			return NumChildren;
+		};
+
+		const auto ChainedVersion = [&]() {
+			return MyClasses
+				 | Where([IsA = Filters::IsChildOf(Bases[0]), IsB = Filters::IsChildOf(Bases[1]), IsC = Filters::IsChildOf(Bases[2]), IsD = Filters::IsChildOf(Bases[3])](const UClass* Class) {
+					   return IsA(Class) || IsB(Class) || IsC(Class) || IsD(Class);
+				   })
+				 | Count();
 		};
 
 		const auto IGRangesVersion = [&]() {
-			return MyObjects | Sum(SumSelector);
+			return MyClasses
+				 | Where(Filters::IsChildOfAny({Bases[0], Bases[1], Bases[2], Bases[3]}))
+				 | Count();
 		};
 
 		// Sanity check that these versions produce the same results.
 		{
-			const int32 Expected = BaselineVersion();
-			const int32 StdActual = StdVersion();
-			const int32 IgrActual = IGRangesVersion();
+			const int32 ExpectedCount = BaselineVersion();
+			const int32 ChainedCount = ChainedVersion();
+			const int32 ActualCount = IGRangesVersion();
 			const bool bSuccess =
-				TestEqual("std version results", StdActual, Expected)
-				&& TestEqual("igr version results", IgrActual, Expected);
+				TestEqual("chained version results", ChainedCount, ExpectedCount)
+				&& TestEqual("igr version results", ActualCount, ExpectedCount);
 			if (!bSuccess)
 			{
 				return;
 			}
 
-			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements were summed."), MyObjects.Num());
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements (%d distinct classes) were filtered into %d elements."), MyClasses.Num(), AllClasses.Num(), ActualCount);
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+		UE_BENCHMARK(NumRuns, ChainedVersion);
+		UE_BENCHMARK(NumRuns, IGRangesVersion);
+	});
+
+	// Objects of several classes in random order (runs of one), tested against several types.
+	It("of_any_type", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectRunsArray(1);
+
+		const auto BaselineVersion = [&]() {
+			int32 NumMatches = 0;
+			for (const UObject* Obj : MyObjects)
+			{
+				if (Obj != nullptr && (Obj->IsA<UEnum>() || Obj->IsA<UScriptStruct>() || Obj->IsA<UFunction>() || Obj->IsA<UPackage>()))
+				{
+					++NumMatches;
+				}
+			}
+
+			return NumMatches;
+		};
+
+		const auto IGRangesVersion = [&]() {
+			return MyObjects
+				 | OfAnyType<UEnum, UScriptStruct, UFunction, UPackage>()
+				 | Count();
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const int32 ExpectedCount = BaselineVersion();
+			const int32 ActualCount = IGRangesVersion();
+			if (!TestEqual("igr version results", ActualCount, ExpectedCount))
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements were filtered into %d elements."), MyObjects.Num(), ActualCount);
 		}
 
 		constexpr int32 NumRuns = 7;
 		UE_BENCHMARK(NumRuns, BaselineVersion);
-		UE_BENCHMARK(NumRuns, StdVersion);
 		UE_BENCHMARK(NumRuns, IGRangesVersion);
 	});
+
+	// Counting objects per class in one pass vs. one `Where | Count` pass per class.
+	It("group_by", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		const auto BaselineVersion = [&]() {
+			TMap<UClass*, int32> Counts;
+			for (const UObject* Obj : MyObjects)
+			{
+				if (Obj != nullptr)
+				{
+					++Counts.FindOrAdd(Obj->GetClass());
+				}
+			}
+
+			return Counts;
+		};
+
+		const auto MultiPassVersion = [&]() {
+			TMap<UClass*, int32> Counts;
+			for (UClass* Class : MyObjects | NonNull() | Select(&UObject::GetClass) | ToSet())
+			{
+				Counts.Emplace(Class, MyObjects | Where([Class](const UObject* Obj) { return Obj != nullptr && Obj->GetClass() == Class; }) | Count());
+			}
+
+			return Counts;
+		};
+
+		const auto IGRangesVersion = [&]() {
+			return MyObjects
+				 | NonNull()
+				 | GroupBy(&UObject::GetClass, Aggregators::Count());
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const TMap<UClass*, int32> ExpectedCounts = BaselineVersion();
+			const TMap<UClass*, int32> MultiPassCounts = MultiPassVersion();
+			const TMap<UClass*, int32> ActualCounts = IGRangesVersion();
+			const bool bSuccess =
+				TestTrue("multi-pass version results", MultiPassCounts.OrderIndependentCompareEqual(ExpectedCounts))
+				&& TestTrue("igr version results", ActualCounts.OrderIndependentCompareEqual(ExpectedCounts));
+			if (!bSuccess)
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements were grouped into %d classes."), MyObjects.Num(), ActualCounts.Num());
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+		UE_BENCHMARK(NumRuns, MultiPassVersion);
+		UE_BENCHMARK(NumRuns, IGRangesVersion);
+	});
+
+	// Few distinct values among many elements: a lazy distinct view only compares against a handful of seen values.
+	It("distinct", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		const auto BaselineVersion = [&]() {
+			TSet<const UObject*> Seen;
+			int32 NumDistinct = 0;
+			for (const UObject* Obj : MyObjects)
+			{
+				if (Obj != nullptr)
+				{
+					bool bIsAlreadyInSet = false;
+					Seen.Emplace(Obj, &bIsAlreadyInSet);
+					if (!bIsAlreadyInSet)
+					{
+						++NumDistinct;
+					}
+				}
+			}
+
+			return NumDistinct;
+		};
+
+		const auto ToSetVersion = [&]() {
+			return (MyObjects | NonNull() | ToSet()).Num();
+		};
+
+		const auto IGRangesVersion = [&]() {
+			return MyObjects | NonNull() | Distinct() | Count();
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const int32 ExpectedNum = BaselineVersion();
+			const int32 ToSetNum = ToSetVersion();
+			const int32 ActualNum = IGRangesVersion();
+			const bool bSuccess =
+				TestEqual("to set version results", ToSetNum, ExpectedNum)
+				&& TestEqual("igr version results", ActualNum, ExpectedNum);
+			if (!bSuccess)
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements have %d distinct objects."), MyObjects.Num(), ActualNum);
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+		UE_BENCHMARK(NumRuns, ToSetVersion);
+		UE_BENCHMARK(NumRuns, IGRangesVersion);
+	});
+
+	// Only the nearest few points are needed, so sorting all of them is wasted work.
+	It("order_by_take", [this]() {
+		constexpr int32 NumElements = 1'000'000;
+		constexpr int32 NumNearest = 10;
+
+		FRandomStream Rng(1234);
+		TArray<FVector> MyPoints;
+		MyPoints.Reserve(NumElements);
+		for (int32 i = 0; i < NumElements; ++i)
+		{
+			MyPoints.Emplace(Rng.VRand() * Rng.FRandRange(0.0, 10'000.0));
+		}
+
+		const FVector Origin(100.0, 200.0, 300.0);
+		const auto DistToOrigin = [&Origin](const FVector& Point) {
+			return FVector::DistSquared(Point, Origin);
+		};
+
+		const auto BaselineVersion = [&]() {
+			TArray<FVector> Sorted = MyPoints;
+			Algo::SortBy(Sorted, DistToOrigin);
+			Sorted.SetNum(NumNearest);
+			return Sorted;
+		};
+
+		const auto IGRangesVersion = [&]() {
+			return MyPoints | OrderBy(DistToOrigin) | std::views::take(NumNearest) | ToArray();
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const TArray<FVector> Expected = BaselineVersion();
+			const TArray<FVector> Actual = IGRangesVersion();
+			const bool bSuccess = TestEqual("igr version results", Actual, Expected);
+			if (!bSuccess)
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("The nearest of %d points is %s."), MyPoints.Num(), *Actual[0].ToString());
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+		UE_BENCHMARK(NumRuns, IGRangesVersion);
+	});
+
+	// The same projection applied per element, per contiguous batch, & per buffered batch.
+	It("chunk_select", [this]() {
+		constexpr int32 NumElements = 10'000'000;
+		constexpr int32 ChunkSize = 1024;
+
+		TArray<int32> MyNumbers;
+		MyNumbers.Reserve(NumElements);
+		for (int32 i = 0; i < NumElements; ++i)
+		{
+			MyNumbers.Emplace(i % 1000 - 500);
+		}
+
+		const auto Project = [](int32 N) {
+			return static_cast<int64>(N) * 3 + 1;
+		};
+
+		const auto BaselineVersion = [&]() {
+			int64 Total = 0;
+			for (const int32 N : MyNumbers)
+			{
+				Total += Project(N);
+			}
+
+			return Total;
+		};
+
+		const auto PerElementVersion = [&]() {
+			return MyNumbers | Select(Project) | Sum();
+		};
+
+		const auto IGRangesVersion = [&]() {
+			int64 Total = 0;
+			for (const TArrayView<const int32> Batch : MyNumbers | Chunk(ChunkSize))
+			{
+				int64 BatchTotal = 0;
+				for (const int32 N : Batch)
+				{
+					BatchTotal += Project(N);
+				}
+
+				Total += BatchTotal;
+			}
+
+			return Total;
+		};
+
+		const auto BufferedVersion = [&]() {
+			int64 Total = 0;
+			for (const TArrayView<int64> Batch : MyNumbers | Select(Project) | Chunk(ChunkSize))
+			{
+				int64 BatchTotal = 0;
+				for (const int64 N : Batch)
+				{
+					BatchTotal += N;
+				}
+
+				Total += BatchTotal;
+			}
+
+			return Total;
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const int64 ExpectedTotal = BaselineVersion();
+			const int64 PerElementTotal = PerElementVersion();
+			const int64 ActualTotal = IGRangesVersion();
+			const int64 BufferedTotal = BufferedVersion();
+			const bool bSuccess =
+				TestEqual("per element version results", PerElementTotal, ExpectedTotal)
+				&& TestEqual("igr version results", ActualTotal, ExpectedTotal)
+				&& TestEqual("buffered version results", BufferedTotal, ExpectedTotal);
+			if (!bSuccess)
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements were projected in batches of %d for a total of %lld."), MyNumbers.Num(), ChunkSize, ActualTotal);
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+		UE_BENCHMARK(NumRuns, PerElementVersion);
+		UE_BENCHMARK(NumRuns, IGRangesVersion);
+		UE_BENCHMARK(NumRuns, BufferedVersion);
+	});
+
+	// Same data as `complex_chain` but with a side-effect-free pipeline so that every reservation policy can be used.
+	It("complex_chain_reserve", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		const auto Pipeline = [&MyObjects]() {
+			return MyObjects
+				 | WhereNot([](const UObject* Obj) { return Obj == GetDefault<UObject>(); })
+				 | OfType<UMetaData>()
+				 | Select(&UMetaData::GetFName);
+		};
+
+		const auto NoReserveVersion = [&]() {
+			return Pipeline() | ToArray();
+		};
+
+		const auto ReserveExactVersion = [&]() {
+			return Pipeline() | ToArray(ReserveExact);
+		};
+
+		const auto ReserveUpperBoundVersion = [&]() {
+			return Pipeline() | ToArray(ReserveUpperBound);
+		};
+
+		FSelectivityEstimate Selectivity;
+		const auto ReservePredictedVersion = [&]() {
+			return Pipeline() | ToArray(ReservePredicted(Selectivity));
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const TArray<FName> Expected = NoReserveVersion();
+			const bool bSuccess =
+				TestEqual("exact version results", ReserveExactVersion(), Expected)
+				&& TestEqual("upper bound version results", ReserveUpperBoundVersion(), Expected)
+				&& TestEqual("predicted version results", ReservePredictedVersion(), Expected);
+			if (!bSuccess)
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements were filtered & transformed into %d elements."), MyObjects.Num(), Expected.Num());
+		}
+
+		UE_LOG(LogIGRangesTests, Log, TEXT("NoReserveVersion: %lld heap allocations."), FAllocationCounter::CountAllocations(NoReserveVersion));
+		UE_LOG(LogIGRangesTests, Log, TEXT("ReserveExactVersion: %lld heap allocations."), FAllocationCounter::CountAllocations(ReserveExactVersion));
+		UE_LOG(LogIGRangesTests, Log, TEXT("ReserveUpperBoundVersion: %lld heap allocations."), FAllocationCounter::CountAllocations(ReserveUpperBoundVersion));
+		UE_LOG(LogIGRangesTests, Log, TEXT("ReservePredictedVersion: %lld heap allocations."), FAllocationCounter::CountAllocations(ReservePredictedVersion));
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, NoReserveVersion);
+		UE_BENCHMARK(NumRuns, ReserveExactVersion);
+		UE_BENCHMARK(NumRuns, ReserveUpperBoundVersion);
+		UE_BENCHMARK(NumRuns, ReservePredictedVersion);
+	});
+
+	It("accumulate", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		const auto BaselineVersion = [&]() {
+			uint64 Result = 0;
+			for (const UObject* Elem : MyObjects)
+			{
+				Result += (Elem != nullptr) ? Elem->GetName().Len() : 0;
+			}
+
+			return Result;
+		};
+
+		const auto Fold = [](uint64 Acc, const UObject* Elem) {
+			return Acc + ((Elem != nullptr) ? Elem->GetName().Len() : 0);
+		};
+
+		const auto StdVersion = [&]() {
+			return std::accumulate(MyObjects.begin(), MyObjects.end(), uint64{}, Fold);
+		};
+
+		const auto IGRangesVersion = [&]() {
+			return MyObjects | Accumulate(uint64{}, Fold);
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const int32 Expected = BaselineVersion();
+			const int32 StdActual = StdVersion();
+			const int32 IgrActual = IGRangesVersion();
+			const bool bSuccess =
+				TestEqual("std version results", StdActual, Expected)
+				&& TestEqual("igr version results", IgrActual, Expected);
+			if (!bSuccess)
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements were accumulated."), MyObjects.Num());
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+		UE_BENCHMARK(NumRuns, StdVersion);
+		UE_BENCHMARK(NumRuns, IGRangesVersion);
+	});
+
+	It("sum", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		const auto BaselineVersion = [&]() {
+			int32 Result = 0;
+			for (const UObject* Elem : MyObjects)
+			{
+				Result += (Elem != nullptr) ? Elem->GetName().Len() : 0;
+			}
+
+			return Result;
+		};
+
+		const auto Fold = [](int32 Acc, const UObject* Elem) {
+			return Acc + ((Elem != nullptr) ? Elem->GetName().Len() : 0);
+		};
+
+		const auto StdVersion = [&]() {
+			return std::accumulate(MyObjects.begin(), MyObjects.end(), int32{}, Fold);
+		};
+
+		const auto SumSelector = [](const UObject* Elem) {
+			return (Elem != nullptr) ? Elem->GetName().Len() : 0;
+		};
+
+		const auto IGRangesVersion = [&]() {
+			return MyObjects | Sum(SumSelector);
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const int32 Expected = BaselineVersion();
+			const int32 StdActual = StdVersion();
+			const int32 IgrActual = IGRangesVersion();
+			const bool bSuccess =
+				TestEqual("std version results", StdActual, Expected)
+				&& TestEqual("igr version results", IgrActual, Expected);
+			if (!bSuccess)
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements were summed."), MyObjects.Num());
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+		UE_BENCHMARK(NumRuns, StdVersion);
+		UE_BENCHMARK(NumRuns, IGRangesVersion);
+	});
+
+	It("sum_contiguous", [this]() {
+		BenchmarkContiguousSum<int32>(*this, TEXT("int32"), [](int32 i) { return i % 7 - 3; });
+		BenchmarkContiguousSum<float>(*this, TEXT("float"), [](int32 i) { return (i % 2 == 0) ? 1.0f : -1.0f; });
+		BenchmarkContiguousSum<double>(*this, TEXT("double"), [](int32 i) { return (i % 2 == 0) ? 1.0 : -1.0; });
+		BenchmarkContiguousSum<FVector>(*this, TEXT("FVector"), [](int32 i) {
+			const double Sign = (i % 2 == 0) ? 1.0 : -1.0;
+			return FVector(Sign, -Sign, 2.0 * Sign);
+		});
+	});
+
+	// Random data so that the filter-based version can't predict its branches.
+	It("count_contiguous", [this]() {
+		FRandomStream Rng(1234);
+		TArray<int32> Numbers;
+		for (int32 i = 0; i < 16 * 1024 * 1024; ++i)
+		{
+			Numbers.Emplace(Rng.RandRange(0, 99));
+		}
+
+		const auto IsSmall = [](int32 X) {
+			return X < 50;
+		};
+
+		const auto FilterVersion = [&]() {
+			return Numbers | std::views::filter(IsSmall) | Count();
+		};
+
+		const auto IGRangesVersion = [&]() {
+			return Numbers | Count(IsSmall);
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const int32 Expected = FilterVersion();
+			const int32 Actual = IGRangesVersion();
+			if (!TestEqual("igr version results", Actual, Expected))
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d of %d elements were counted."), Actual, Numbers.Num());
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, FilterVersion);
+		UE_BENCHMARK(NumRuns, IGRangesVersion);
+	});
+
+	// The searched-for values are missing or at the end so that every element has to be compared.
+	It("index_of_contiguous", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+		const UObject* const Missing = GetTransientPackage();
+
+		TArray<int32> Numbers;
+		for (int32 i = 0; i < MyObjects.Num(); ++i)
+		{
+			Numbers.Emplace(i);
+		}
+
+		const int32 Last = Numbers.Last();
+
+		const auto BaselineVersion = [&]() {
+			for (const UObject* Obj : MyObjects)
+			{
+				if (Obj == Missing)
+				{
+					return INDEX_NONE;
+				}
+			}
+
+			for (int32 i = 0; i < Numbers.Num(); ++i)
+			{
+				if (Numbers[i] == Last)
+				{
+					return i;
+				}
+			}
+
+			return INDEX_NONE;
+		};
+
+		const auto StdVersion = [&]() {
+			const bool bContainsMissing = std::ranges::find(MyObjects, Missing) != std::ranges::end(MyObjects);
+			const int32 Index = static_cast<int32>(std::ranges::find(Numbers, Last) - std::ranges::begin(Numbers));
+			return bContainsMissing ? INDEX_NONE : Index;
+		};
+
+		const auto IGRangesVersion = [&]() {
+			const bool bContainsMissing = MyObjects | Contains(Missing);
+			const int32 Index = Numbers | IndexOf(Last);
+			return bContainsMissing ? INDEX_NONE : Index;
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const int32 Expected = BaselineVersion();
+			const int32 StdActual = StdVersion();
+			const int32 IgrActual = IGRangesVersion();
+			const bool bSuccess =
+				TestEqual("std version results", StdActual, Expected)
+				&& TestEqual("igr version results", IgrActual, Expected);
+			if (!bSuccess)
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d pointers & %d integers were searched."), MyObjects.Num(), Numbers.Num());
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+		UE_BENCHMARK(NumRuns, StdVersion);
+		UE_BENCHMARK(NumRuns, IGRangesVersion);
+	});
+
+	// `Cast` & `OfType` remember the previous element's class, which pays off when runs of elements share a class.
+	It("of_type_class_runs", [this]() {
+		const int32 MaxRunLengths[] = {1, 4, 32};
+		for (const int32 MaxRunLength : MaxRunLengths)
+		{
+			const TArray<const UObject*> MyObjects = MakeObjectRunsArray(MaxRunLength);
+
+			const auto BaselineVersion = [&]() {
+				int32 Result = 0;
+				for (const UObject* Obj : MyObjects)
+				{
+					if (const UStruct* Struct = ::Cast<UStruct>(Obj))
+					{
+						Result += Struct->GetStructureSize() > 0;
+					}
+				}
+
+				return Result;
+			};
+
+			const auto IGRangesVersion = [&]() {
+				return MyObjects
+					 | OfType<UStruct>()
+					 | Count([](const UStruct* Struct) { return Struct->GetStructureSize() > 0; });
+			};
+
+			const auto IGRangesClassVersion = [&]() {
+				return MyObjects
+					 | OfType(UStruct::StaticClass())
+					 | Count([](const UObject* Obj) { return static_cast<const UStruct*>(Obj)->GetStructureSize() > 0; });
+			};
+
+			// Sanity check that these versions produce the same results.
+			{
+				const int32 Expected = BaselineVersion();
+				const int32 IgrActual = IGRangesVersion();
+				const int32 IgrClassActual = IGRangesClassVersion();
+				const bool bSuccess =
+					TestEqual("igr version results", IgrActual, Expected)
+					&& TestEqual("igr class version results", IgrClassActual, Expected);
+				if (!bSuccess)
+				{
+					return;
+				}
+
+				UE_LOG(LogIGRangesTests, Log, TEXT("%d of %d elements (runs of up to %d) were structs."), Expected, MyObjects.Num(), MaxRunLength);
+			}
+
+			constexpr int32 NumRuns = 7;
+			UE_BENCHMARK(NumRuns, BaselineVersion);
+			UE_BENCHMARK(NumRuns, IGRangesVersion);
+			UE_BENCHMARK(NumRuns, IGRangesClassVersion);
+		}
+	});
+
+	It("parallel_accumulate", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		const auto Fold = [](uint64 Acc, const UObject* Elem) {
+			return Acc + ((Elem != nullptr) ? Elem->GetName().Len() : 0);
+		};
+
+		const auto BaselineVersion = [&]() {
+			return MyObjects | Accumulate(uint64{}, Fold);
+		};
+
+		FParallelOptions Options;
+		const auto IGRangesVersion = [&]() {
+			return MyObjects | ParallelAccumulate(uint64{}, Fold, std::plus<>(), Options);
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const uint64 Expected = BaselineVersion();
+			const uint64 Actual = IGRangesVersion();
+			if (!TestEqual("igr version results", Actual, Expected))
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements were accumulated."), MyObjects.Num());
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+
+		for (const int32 NumTasks : GetParallelTaskCounts())
+		{
+			UE_LOG(LogIGRangesTests, Log, TEXT("MaxTasks=%d"), NumTasks);
+			Options.MaxTasks = NumTasks;
+			UE_BENCHMARK(NumRuns, IGRangesVersion);
+		}
+	});
+
+	It("parallel_to_array", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		const auto HasLongName = [](const UObject* Obj) {
+			return Obj->GetName().Len() > 10;
+		};
+
+		const auto GetFName = [](const UObject* Obj) {
+			return Obj->GetFName();
+		};
+
+		const auto BaselineVersion = [&]() {
+			return MyObjects | NonNull() | Where(HasLongName) | Select(GetFName) | ToArray();
+		};
+
+		FParallelOptions Options;
+		const auto IGRangesVersion = [&]() {
+			return MyObjects | ParallelToArray(NonNull() | Where(HasLongName) | Select(GetFName), Options);
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const TArray<FName> Expected = BaselineVersion();
+			const TArray<FName> Actual = IGRangesVersion();
+			if (!TestEqual("igr version results", Actual, Expected))
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d of %d elements have long names."), Actual.Num(), MyObjects.Num());
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+
+		for (const int32 NumTasks : GetParallelTaskCounts())
+		{
+			UE_LOG(LogIGRangesTests, Log, TEXT("MaxTasks=%d"), NumTasks);
+			Options.MaxTasks = NumTasks;
+			UE_BENCHMARK(NumRuns, IGRangesVersion);
+		}
+	});
+
+	It("parallel_first_or_default", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		// Look for an object near the end so that the serial version has to test most of the array.
+		const UObject* const Target = MyObjects | Skip(MyObjects.Num() * 9 / 10) | NonNull() | FirstOrDefault();
+		if (!TestNotNull("target", Target))
+		{
+			return;
+		}
+
+		const FString TargetName = Target->GetName();
+		const auto HasTargetName = [&TargetName](const UObject* Obj) {
+			return Obj != nullptr && Obj->GetName() == TargetName;
+		};
+
+		const auto BaselineVersion = [&]() {
+			return MyObjects | FirstOrDefault(HasTargetName);
+		};
+
+		FParallelOptions Options;
+		const auto IGRangesVersion = [&]() {
+			return MyObjects | ParallelFirstOrDefault(HasTargetName, Options);
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const UObject* const Expected = BaselineVersion();
+			const UObject* const Actual = IGRangesVersion();
+			if (!TestEqual("igr version results", Actual, Expected))
+			{
+				return;
+			}
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+
+		for (const int32 NumTasks : GetParallelTaskCounts())
+		{
+			UE_LOG(LogIGRangesTests, Log, TEXT("MaxTasks=%d"), NumTasks);
+			Options.MaxTasks = NumTasks;
+			UE_BENCHMARK(NumRuns, IGRangesVersion);
+		}
+	});
+
+	It("as_parallel", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		const auto HasLongName = [](const UObject* Obj) {
+			return Obj->GetName().Len() > 10;
+		};
+
+		const auto GetFName = [](const UObject* Obj) {
+			return Obj->GetFName();
+		};
+
+		const auto BaselineVersion = [&]() {
+			return MyObjects | NonNull() | Where(HasLongName) | Select(GetFName) | ToArray();
+		};
+
+		FParallelOptions Options;
+		const auto IGRangesVersion = [&]() {
+			return MyObjects | AsParallel(Options) | NonNull() | Where(HasLongName) | Select(GetFName) | ToArray();
+		};
+
+		const auto IGRangesUnorderedVersion = [&]() {
+			return MyObjects | AsParallel(Options) | AsUnordered() | NonNull() | Where(HasLongName) | Select(GetFName) | ToArray();
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const TArray<FName> Expected = BaselineVersion();
+			const TArray<FName> Actual = IGRangesVersion();
+			if (!TestEqual("igr version results", Actual, Expected))
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d of %d elements have long names."), Actual.Num(), MyObjects.Num());
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+
+		for (const int32 NumTasks : GetParallelTaskCounts())
+		{
+			UE_LOG(LogIGRangesTests, Log, TEXT("MaxTasks=%d"), NumTasks);
+			Options.MaxTasks = NumTasks;
+			UE_BENCHMARK(NumRuns, IGRangesVersion);
+			UE_BENCHMARK(NumRuns, IGRangesUnorderedVersion);
+		}
+	});
+
+	It("parallel_sum", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		const auto SumSelector = [](const UObject* Elem) {
+			return (Elem != nullptr) ? Elem->GetName().Len() : 0;
+		};
+
+		const auto BaselineVersion = [&]() {
+			return MyObjects | Sum(SumSelector);
+		};
+
+		FParallelOptions Options;
+		const auto IGRangesVersion = [&]() {
+			return MyObjects | ParallelSum(SumSelector, Options);
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const int32 Expected = BaselineVersion();
+			const int32 Actual = IGRangesVersion();
+			if (!TestEqual("igr version results", Actual, Expected))
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements were summed."), MyObjects.Num());
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+
+		for (const int32 NumTasks : GetParallelTaskCounts())
+		{
+			UE_LOG(LogIGRangesTests, Log, TEXT("MaxTasks=%d"), NumTasks);
+			Options.MaxTasks = NumTasks;
+			UE_BENCHMARK(NumRuns, IGRangesVersion);
+		}
+	});
+
+	It("parallel_count", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		const auto HasLongName = [](const UObject* Elem) {
+			return Elem != nullptr && Elem->GetName().Len() > 8;
+		};
+
+		const auto BaselineVersion = [&]() {
+			return MyObjects | Count(HasLongName);
+		};
+
+		FParallelOptions Options;
+		const auto IGRangesVersion = [&]() {
+			return MyObjects | ParallelCount(HasLongName, Options);
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const int32 Expected = BaselineVersion();
+			const int32 Actual = IGRangesVersion();
+			if (!TestEqual("igr version results", Actual, Expected))
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements were counted."), MyObjects.Num());
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, BaselineVersion);
+
+		for (const int32 NumTasks : GetParallelTaskCounts())
+		{
+			UE_LOG(LogIGRangesTests, Log, TEXT("MaxTasks=%d"), NumTasks);
+			Options.MaxTasks = NumTasks;
+			UE_BENCHMARK(NumRuns, IGRangesVersion);
+		}
+	});
+
+	It("to_array_allocators", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		// Lots of small queries, like gameplay code might run every frame.
+		constexpr int32 QuerySize = 60;
+		const int32 NumQueries = MyObjects.Num() / QuerySize;
+
+		const auto Query = [&](int32 QueryIndex) {
+			return TArrayView<const UObject* const>(MyObjects.GetData() + QueryIndex * QuerySize, QuerySize)
+				 | OfType<UMetaData>();
+		};
+
+		const auto DefaultAllocatorVersion = [&]() {
+			int32 Results = 0;
+			for (int32 i = 0; i < NumQueries; ++i)
+			{
+				Results += (Query(i) | ToArray()).Num();
+			}
+
+			return Results;
+		};
+
+		const auto InlineAllocatorVersion = [&]() {
+			int32 Results = 0;
+			for (int32 i = 0; i < NumQueries; ++i)
+			{
+				Results += (Query(i) | ToArray<TInlineAllocator<8>>()).Num();
+			}
+
+			return Results;
+		};
+
+		const auto MemStackAllocatorVersion = [&]() {
+			int32 Results = 0;
+			for (int32 i = 0; i < NumQueries; ++i)
+			{
+				FMemMark Mark(FMemStack::Get());
+				Results += (Query(i) | ToArray<TMemStackAllocator<>>()).Num();
+			}
+
+			return Results;
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const int32 Expected = DefaultAllocatorVersion();
+			const bool bSuccess =
+				TestEqual("inline version results", InlineAllocatorVersion(), Expected)
+				&& TestEqual("mem stack version results", MemStackAllocatorVersion(), Expected);
+			if (!bSuccess)
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d queries produced %d elements."), NumQueries, Expected);
+		}
+
+		UE_LOG(LogIGRangesTests, Log, TEXT("DefaultAllocatorVersion: %lld heap allocations."), FAllocationCounter::CountAllocations(DefaultAllocatorVersion));
+		UE_LOG(LogIGRangesTests, Log, TEXT("InlineAllocatorVersion: %lld heap allocations."), FAllocationCounter::CountAllocations(InlineAllocatorVersion));
+		UE_LOG(LogIGRangesTests, Log, TEXT("MemStackAllocatorVersion: %lld heap allocations."), FAllocationCounter::CountAllocations(MemStackAllocatorVersion));
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, DefaultAllocatorVersion);
+		UE_BENCHMARK(NumRuns, InlineAllocatorVersion);
+		UE_BENCHMARK(NumRuns, MemStackAllocatorVersion);
+	});
+
+	// Same pipeline run several times (like a query that runs every frame), either materializing a new array each time
+	// or refilling a reused scratch array.
+	It("to_array_into", [this]() {
+		const TArray<const UObject*> MyObjects = MakeObjectsArray();
+
+		constexpr int32 NumFrames = 10;
+
+		// Yields `FString`s by value so that each element must be moved (not copied) into the results.
+		const auto Pipeline = [&MyObjects]() {
+			return MyObjects
+				 | OfType<UMetaData>()
+				 | Select([](const UMetaData* MetaData) { return MetaData->GetName(); });
+		};
+
+		const auto ToArrayVersion = [&]() {
+			int32 Results = 0;
+			for (int32 i = 0; i < NumFrames; ++i)
+			{
+				Results += (Pipeline() | ToArray()).Num();
+			}
+
+			return Results;
+		};
+
+		TArray<FString> Scratch;
+		const auto ToArrayIntoVersion = [&]() {
+			int32 Results = 0;
+			for (int32 i = 0; i < NumFrames; ++i)
+			{
+				Results += (Pipeline() | ToArrayInto(Scratch)).Num();
+			}
+
+			return Results;
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const int32 Expected = ToArrayVersion();
+			if (!TestEqual("into version results", ToArrayIntoVersion(), Expected))
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d frames produced %d elements."), NumFrames, Expected);
+		}
+
+		// The scratch array has already grown, so this only counts the allocations made by the elements themselves.
+		UE_LOG(LogIGRangesTests, Log, TEXT("ToArrayVersion: %lld heap allocations."), FAllocationCounter::CountAllocations(ToArrayVersion));
+		UE_LOG(LogIGRangesTests, Log, TEXT("ToArrayIntoVersion: %lld heap allocations."), FAllocationCounter::CountAllocations(ToArrayIntoVersion));
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, ToArrayVersion);
+		UE_BENCHMARK(NumRuns, ToArrayIntoVersion);
+	});
+
+	// Containers backed by `TSparseArray` (with holes where elements were removed), queried directly vs. copied into a
+	// temporary `TArray` first (which was required before these containers had customization points).
+	It("container_sources", [this]() {
+		const TArray<const UObject*> AllObjects = MakeObjectsArray();
+		const TArrayView<const UObject* const> MyObjects(AllObjects.GetData(), AllObjects.Num() / 10);
+
+		TSet<int32> Indices;
+		TMap<int32, const UObject*> ObjectsByIndex;
+		TSparseArray<const UObject*> SparseObjects;
+		Indices.Reserve(MyObjects.Num());
+		ObjectsByIndex.Reserve(MyObjects.Num());
+		SparseObjects.Reserve(MyObjects.Num());
+		for (int32 i = 0; i < MyObjects.Num(); ++i)
+		{
+			Indices.Add(i);
+			ObjectsByIndex.Add(i, MyObjects[i]);
+			SparseObjects.Add(MyObjects[i]);
+		}
+
+		// Remove every 4th element to leave holes.
+		for (int32 i = 0; i < MyObjects.Num(); i += 4)
+		{
+			Indices.Remove(i);
+			ObjectsByIndex.Remove(i);
+			SparseObjects.RemoveAt(i);
+		}
+
+		const auto IsEven = [](int32 X) {
+			return X % 2 == 0;
+		};
+
+		const auto SetCopyVersion = [&]() {
+			return Indices.Array() | Count(IsEven);
+		};
+
+		const auto SetDirectVersion = [&]() {
+			return Indices | Count(IsEven);
+		};
+
+		const auto MapCopyVersion = [&]() {
+			TArray<const UObject*> Values;
+			ObjectsByIndex.GenerateValueArray(Values);
+			return Values | OfType<UMetaData>() | Count();
+		};
+
+		const auto MapDirectVersion = [&]() {
+			return ObjectsByIndex
+				 | Select(&TPair<int32, const UObject*>::Value)
+				 | OfType<UMetaData>()
+				 | Count();
+		};
+
+		const auto SparseArrayCopyVersion = [&]() {
+			TArray<const UObject*> Values;
+			Values.Reserve(SparseObjects.Num());
+			for (const UObject* Obj : SparseObjects)
+			{
+				Values.Add(Obj);
+			}
+
+			return Values | OfType<UMetaData>() | Count();
+		};
+
+		const auto SparseArrayDirectVersion = [&]() {
+			return SparseObjects | OfType<UMetaData>() | Count();
+		};
+
+		// Sanity check that these versions produce the same results.
+		{
+			const bool bSuccess =
+				TestEqual("set version results", SetDirectVersion(), SetCopyVersion())
+				&& TestEqual("map version results", MapDirectVersion(), MapCopyVersion())
+				&& TestEqual("sparse array version results", SparseArrayDirectVersion(), SparseArrayCopyVersion());
+			if (!bSuccess)
+			{
+				return;
+			}
+
+			UE_LOG(LogIGRangesTests, Log, TEXT("%d elements are in each container."), Indices.Num());
+		}
+
+		constexpr int32 NumRuns = 7;
+		UE_BENCHMARK(NumRuns, SetCopyVersion);
+		UE_BENCHMARK(NumRuns, SetDirectVersion);
+		UE_BENCHMARK(NumRuns, MapCopyVersion);
+		UE_BENCHMARK(NumRuns, MapDirectVersion);
+		UE_BENCHMARK(NumRuns, SparseArrayCopyVersion);
+		UE_BENCHMARK(NumRuns, SparseArrayDirectVersion);
+	});
 }
 
 #endif // WITH_DEV_AUTOMATION_TESTS
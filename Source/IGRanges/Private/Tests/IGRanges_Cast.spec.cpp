@@ -67,6 +67,37 @@ void FIGRangesCastSpec::Define()
 	It("yields_objects_of_specified_type_or_null (TWeakObjectPtr)", [this]() {
 		TestPointers<TWeakObjectPtr<const UObject>>();
 	});
+
+	// Runs of objects with the same class reuse the previous class's result, which must not leak into the next run.
+	It("runs_of_same_class", [this]() {
+		const UObject* O = GetDefault<UObject>();
+		const UObject* F = GetDefault<UField>();
+		const UObject* E = GetDefault<UEnum>();
+		const UObject* S = GetDefault<UStruct>();
+		const UObject* C = GetDefault<UClass>();
+		const UObject* SomePointers[] = {O, O, O, F, F, nullptr, E, E, E, S, C, C, C, nullptr, F, O, O};
+
+		TestPointers<const UField>(SomePointers);
+		TestPointers<const UStruct>(SomePointers);
+		TestPointers<const UClass>(SomePointers);
+	});
+
+	// Copies of a view (e.g. when it's stored, passed to another adapter, or applied to each chunk of a parallel query) each
+	// remember their own class, so iterating one doesn't affect the other.
+	It("copied_view", [this]() {
+		const UObject* O = GetDefault<UObject>();
+		const UObject* C = GetDefault<UClass>();
+		const UObject* SomePointers[] = {C, O};
+
+		const auto View = SomePointers | IG::Ranges::Cast<const UStruct>();
+		auto It = View.begin();
+		TestTrue("first", *It == C);
+
+		const auto Copy = View;
+		TestTrue("copy first", *Copy.begin() == C);
+		TestTrue("second", *++It == nullptr);
+		TestTrue("copy second", *++Copy.begin() == nullptr);
+	});
 }
 
 #endif // WITH_DEV_AUTOMATION_TESTS
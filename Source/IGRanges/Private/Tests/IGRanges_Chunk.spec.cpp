@@ -0,0 +1,95 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/Chunk.h"
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/Select.h"
+#include "IGRanges/Take.h"
+#include "IGRanges/Where.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesChunkSpec, "IG.Ranges.Chunk", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesChunkSpec::Define()
+{
+	using namespace IG::Ranges;
+
+	It("empty", [this]() {
+		const TArray<int32> Empty;
+		TestEqual("contiguous", static_cast<int32>(std::ranges::distance(Empty | Chunk(3))), 0);
+		TestEqual("buffered", static_cast<int32>(std::ranges::distance(Empty | Select([](int32 N) { return N; }) | Chunk(3))), 0);
+	});
+
+	// Contiguous sequences are viewed in place.
+	It("contiguous", [this]() {
+		TArray<int32> Numbers = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+		const auto Chunks = Numbers | Chunk(4);
+
+		static_assert(std::ranges::random_access_range<decltype(Chunks)>);
+		static_assert(std::is_same_v<std::ranges::range_value_t<decltype(Chunks)>, TArrayView<int32>>);
+		static_assert(std::is_same_v<std::ranges::range_value_t<decltype(std::as_const(Numbers) | Chunk(4))>, TArrayView<const int32>>);
+
+		if (TestEqual("count", static_cast<int32>(std::ranges::size(Chunks)), 3))
+		{
+			TestTrue("first data", Chunks[0].GetData() == &Numbers[0]);
+			TestTrue("last data", Chunks[2].GetData() == &Numbers[8]);
+			TestEqual("first num", Chunks[0].Num(), 4);
+			TestEqual("last num", Chunks[2].Num(), 2);
+		}
+
+		TestEqual("exact", static_cast<int32>(std::ranges::size(Numbers | Chunk(5))), 2);
+		TestEqual("view", static_cast<int32>(std::ranges::size(TArrayView<int32>(Numbers) | Chunk(20))), 1);
+	});
+
+	// Other sequences are copied into a buffer one batch at a time.
+	It("buffered", [this]() {
+		const TArray<int32> Numbers = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+		TArray<int32> Sums;
+		TArray<int32> Nums;
+		for (const TArrayView<int32> Batch : Numbers | Where([](int32 N) { return N % 2 == 0; }) | Chunk(2))
+		{
+			int32 BatchSum = 0;
+			for (const int32 N : Batch)
+			{
+				BatchSum += N;
+			}
+
+			Sums.Emplace(BatchSum);
+			Nums.Emplace(Batch.Num());
+		}
+
+		TestEqual("sums", Sums, TArray<int32>({2, 10, 8}));
+		TestEqual("nums", Nums, TArray<int32>({2, 2, 1}));
+		TestEqual("sized", static_cast<int32>(std::ranges::size(Numbers | Select([](int32 N) { return N; }) | Chunk(3))), 4);
+	});
+
+	// Filters upstream aren't invoked for elements after the last batch that's read.
+	It("short_circuit", [this]() {
+		const TArray<int32> Numbers = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+		int32 NumCalls = 0;
+		const auto IsEven = [&NumCalls](int32 N) {
+			++NumCalls;
+			return N % 2 == 0;
+		};
+
+		int32 NumBatches = 0;
+		for (const TArrayView<int32> Batch : Numbers | Where(IsEven) | Chunk(2) | Take(1))
+		{
+			TestEqual("num", Batch.Num(), 2);
+			++NumBatches;
+		}
+
+		TestEqual("batches", NumBatches, 1);
+
+		TestEqual("calls", NumCalls, 3);
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
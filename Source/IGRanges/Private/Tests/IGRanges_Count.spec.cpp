@@ -1,6 +1,7 @@
 ﻿// Copyright Ian Good
 
 #include "IGRanges/Count.h"
+#include "IGRanges/CustomizationPoints.h"
 #include "IGRangesInternal.h"
 #include "Misc/AutomationTest.h"
 #include <ranges>
@@ -55,6 +56,39 @@ void FIGRangesCountSpec::Define()
 		ActualCount = SomeValues | Count(IsEven);
 		TestEqual("count", ActualCount, ExpectedCount);
 	});
+
+	It("contiguous", [this]() {
+		enum class EColor : uint8
+		{
+			Red,
+			Green,
+			Blue,
+		};
+
+		TArray<int32> Numbers;
+		TArray<float> Floats;
+		TArray<EColor> Colors;
+		TArray<const int32*> Pointers;
+		for (int32 i = 0; i < 1001; ++i)
+		{
+			Numbers.Emplace((i * 7919) % 100);
+			Floats.Emplace(static_cast<float>(i % 10) - 4.5f);
+			Colors.Emplace(static_cast<EColor>(i % 3));
+			Pointers.Emplace((i % 4 == 0) ? nullptr : &SomeValues[i % NumSomeValues]);
+		}
+
+		TestEqual("int32", Numbers | Count([](int32 X) { return X < 50; }), 501);
+		TestEqual("float", Floats | Count([](float X) { return X > 0.0f; }), 500);
+		TestEqual("enum", Colors | Count([](EColor X) { return X == EColor::Blue; }), 333);
+		TestEqual("pointer", Pointers | Count([](const int32* X) { return X != nullptr; }), 750);
+		TestEqual("empty", TArray<int32>() | Count([](int32 X) { return X < 50; }), 0);
+
+		// The predicate is still invoked once per element, in order.
+		int32 NumCalls = 0;
+		const int32 ActualCount = Numbers | Count([&NumCalls](int32 X) { return NumCalls++ % 2 == 0; });
+		TestEqual("calls", NumCalls, Numbers.Num());
+		TestEqual("every other", ActualCount, 501);
+	});
 }
 
 #endif // WITH_DEV_AUTOMATION_TESTS
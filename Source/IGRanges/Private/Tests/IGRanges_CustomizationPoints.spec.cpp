@@ -1,9 +1,16 @@
 ﻿// Copyright Ian Good
 
 #include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/Select.h"
+#include "IGRanges/Sum.h"
+#include "IGRanges/ToArray.h"
+#include "IGRanges/Where.h"
 #include "IGRangesInternal.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/MemStack.h"
+#include <algorithm>
 #include <ranges>
+#include <utility>
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -38,9 +45,9 @@ static void CheckCompat(auto&& Container)
 	}
 }
 
-#define IGR_CHECK_COMPAT(_ContainerType)    \
+#define IGR_CHECK_COMPAT(...)              \
 	{                                       \
-		_ContainerType C;                   \
+		__VA_ARGS__ C;                      \
 		CheckCompat(C);                     \
 		CheckCompat(MoveTempIfPossible(C)); \
 	}
@@ -53,10 +60,135 @@ void FIGRangesCPOSpec::Define()
 		IGR_CHECK_COMPAT(const TArray<int32>);
 		IGR_CHECK_COMPAT(const TArray<const int32>);
 
+		IGR_CHECK_COMPAT(TArray64<int32>);
+		IGR_CHECK_COMPAT(const TArray64<int32>);
+		IGR_CHECK_COMPAT(TArray<int32, TInlineAllocator<4>>);
+		IGR_CHECK_COMPAT(const TArray<int32, TInlineAllocator<4>>);
+		IGR_CHECK_COMPAT(TArray<int32, TFixedAllocator<4>>);
+		{
+			FMemMark Mark(FMemStack::Get());
+			IGR_CHECK_COMPAT(TArray<int32, TMemStackAllocator<>>);
+		}
+
 		IGR_CHECK_COMPAT(TArrayView<int32>);
 		IGR_CHECK_COMPAT(TArrayView<const int32>);
 		IGR_CHECK_COMPAT(const TArrayView<int32>);
 		IGR_CHECK_COMPAT(const TArrayView<const int32>);
+		IGR_CHECK_COMPAT(TArrayView64<int32>);
+
+		IGR_CHECK_COMPAT(TSet<int32>);
+		IGR_CHECK_COMPAT(TSparseArray<int32>);
+		IGR_CHECK_COMPAT(TChunkedArray<int32>);
+	});
+
+	It("range_categories", [this]() {
+		static_assert(std::ranges::contiguous_range<TArray<int32>> && std::ranges::sized_range<TArray<int32>>);
+		static_assert(std::ranges::contiguous_range<TArray64<int32>> && std::ranges::sized_range<TArray64<int32>>);
+		static_assert(std::ranges::contiguous_range<TArray<int32, TInlineAllocator<4>>> && std::ranges::sized_range<TArray<int32, TInlineAllocator<4>>>);
+		static_assert(std::ranges::contiguous_range<const TArray<int32, TFixedAllocator<4>>>);
+		static_assert(std::ranges::contiguous_range<TArray<int32, TMemStackAllocator<>>>);
+
+		static_assert(std::ranges::contiguous_range<TArrayView<int32>> && std::ranges::sized_range<TArrayView<int32>>);
+		static_assert(std::ranges::borrowed_range<TArrayView<int32>> && std::ranges::view<TArrayView<int32>>);
+		static_assert(std::ranges::borrowed_range<TArrayView64<const int32>> && std::ranges::view<TArrayView64<const int32>>);
+
+		static_assert(std::ranges::forward_range<TSet<int32>> && std::ranges::sized_range<TSet<int32>>);
+		static_assert(std::ranges::forward_range<const TSet<int32>> && std::ranges::sized_range<const TSet<int32>>);
+		static_assert(std::ranges::forward_range<TMap<int32, int32>> && std::ranges::sized_range<TMap<int32, int32>>);
+		static_assert(std::ranges::forward_range<TSparseArray<int32>> && std::ranges::sized_range<TSparseArray<int32>>);
+		static_assert(std::ranges::random_access_range<TChunkedArray<int32>> && std::ranges::sized_range<TChunkedArray<int32>>);
+		static_assert(std::ranges::random_access_range<TBitArray<>> && std::ranges::sized_range<TBitArray<>>);
+
+		static_assert(std::is_same_v<std::ranges::range_reference_t<TSet<int32>>, int32&>);
+		static_assert(std::is_same_v<std::ranges::range_reference_t<const TSet<int32>>, const int32&>);
+		static_assert(std::is_same_v<std::ranges::range_reference_t<TMap<int32, int32>>, TPair<int32, int32>&>);
+		static_assert(std::is_same_v<std::ranges::range_reference_t<TBitArray<>>, bool>);
+	});
+
+	using namespace IG::Ranges;
+
+	// A temporary view can be used with algorithms that return iterators because views don't own their elements.
+	It("array_view_borrowed", [this]() {
+		TArray<int32, TInlineAllocator<8>> Numbers = {1, 2, 3, 4};
+		const auto It = std::ranges::find(TArrayView<int32>(Numbers), 3);
+		TestTrue("found", It == Numbers.GetData() + 2);
+	});
+
+	// Removed elements leave holes in the set's storage that must be skipped.
+	It("set", [this]() {
+		TSet<int32> TestMe;
+		for (int32 i = 0; i < 20; ++i)
+		{
+			TestMe.Add(i);
+		}
+
+		for (int32 i = 0; i < 20; i += 3)
+		{
+			TestMe.Remove(i);
+		}
+
+		TestEqual("sum", TestMe | Sum(), 190 - 63);
+		TestEqual("evens", TestMe | Where([](int32 X) { return X % 2 == 0; }) | ToArray(), TArray<int32>{2, 4, 8, 10, 14, 16});
+		TestEqual("const", std::as_const(TestMe) | ToArray(), TestMe.Array());
+	});
+
+	It("map", [this]() {
+		TMap<int32, int32> TestMe;
+		for (int32 i = 0; i < 10; ++i)
+		{
+			TestMe.Add(i, i * 10);
+		}
+
+		TestMe.Remove(3);
+
+		TestEqual("keys", TestMe | Select(&TPair<int32, int32>::Key) | Sum(), 45 - 3);
+		TestEqual("values", TestMe | Select(&TPair<int32, int32>::Value) | Sum(), 450 - 30);
+
+		// Values may be modified through the range.
+		for (TPair<int32, int32>& Pair : TestMe | Where([](auto&& Pair) { return Pair.Key < 5; }))
+		{
+			Pair.Value = 0;
+		}
+
+		TestEqual("modified values", std::as_const(TestMe) | Select(&TPair<int32, int32>::Value) | Sum(), 450 - 100);
+	});
+
+	It("sparse_array", [this]() {
+		TSparseArray<int32> TestMe;
+		for (int32 i = 0; i < 10; ++i)
+		{
+			TestMe.Add(i);
+		}
+
+		TestMe.RemoveAt(0);
+		TestMe.RemoveAt(5);
+		TestMe.RemoveAt(9);
+
+		TestEqual("count", static_cast<int32>(std::ranges::distance(TestMe)), 7);
+		TestEqual("contents", TestMe | ToArray(), TArray<int32>{1, 2, 3, 4, 6, 7, 8});
+	});
+
+	It("chunked_array", [this]() {
+		// Small chunks so that the elements span several of them.
+		TChunkedArray<int32, 16> TestMe;
+		for (int32 i = 0; i < 10; ++i)
+		{
+			TestMe.AddElement(i);
+		}
+
+		TestEqual("sum", TestMe | Sum(), 45);
+		TestEqual("reversed", TestMe | std::views::reverse | std::views::take(3) | ToArray(), TArray<int32>{9, 8, 7});
+	});
+
+	It("bit_array", [this]() {
+		TBitArray<> TestMe;
+		for (int32 i = 0; i < 10; ++i)
+		{
+			TestMe.Add(i % 3 == 0);
+		}
+
+		TestEqual("set bits", static_cast<int32>(std::ranges::count(TestMe, true)), 4);
+		TestEqual("contents", TestMe | ToArray(), TArray<bool>{true, false, false, true, false, false, true, false, false, true});
 	});
 }
 
@@ -0,0 +1,85 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/Distinct.h"
+#include "IGRanges/FirstOrDefault.h"
+#include "IGRanges/ToArray.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include <ranges>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesDistinctSpec, "IG.Ranges.Distinct", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesDistinctSpec::Define()
+{
+	using namespace IG::Ranges;
+
+	It("empty", [this]() {
+		const TArray<int32> Empty;
+		TestTrue("empty", (Empty | Distinct() | ToArray()).IsEmpty());
+	});
+
+	It("first_occurrences_in_order", [this]() {
+		const TArray<int32> Numbers = {3, 1, 3, 2, 1, 4, 2, 3};
+		TestEqual("distinct", Numbers | Distinct() | ToArray(), TArray<int32>({3, 1, 2, 4}));
+	});
+
+	It("distinct_by", [this]() {
+		struct FItem
+		{
+			int32 Category = 0;
+			int32 Id = 0;
+		};
+
+		const TArray<FItem> Items = {{1, 10}, {2, 20}, {1, 30}, {3, 40}, {2, 50}};
+		const TArray<FItem> Firsts = Items | DistinctBy(&FItem::Category) | ToArray();
+
+		if (TestEqual("count", Firsts.Num(), 3))
+		{
+			TestEqual("first", Firsts[0].Id, 10);
+			TestEqual("second", Firsts[1].Id, 20);
+			TestEqual("third", Firsts[2].Id, 40);
+		}
+	});
+
+	// More distinct values than fit in the inline buffer.
+	It("many_values", [this]() {
+		TArray<int32> Numbers;
+		for (int32 i = 0; i < 200; ++i)
+		{
+			Numbers.Emplace(i % 50);
+		}
+
+		TArray<int32> Expected;
+		for (int32 i = 0; i < 50; ++i)
+		{
+			Expected.Emplace(i);
+		}
+
+		TestEqual("distinct", Numbers | Distinct() | ToArray(), Expected);
+	});
+
+	// Only the elements up to the one that's found are visited.
+	It("lazy", [this]() {
+		const TArray<int32> Numbers = {5, 5, 7, 5, 8, 7, 9, 10, 11};
+
+		int32 NumCalls = 0;
+		const int32 FirstEven = Numbers | DistinctBy([&NumCalls](int32 N) { ++NumCalls; return N; }) | FirstOrDefault([](int32 N) { return N % 2 == 0; });
+
+		TestEqual("first even", FirstEven, 8);
+		TestEqual("calls", NumCalls, 5);
+	});
+
+	// The seen values are kept in the view, so iterating it again starts over.
+	It("iterate_twice", [this]() {
+		const TArray<int32> Numbers = {1, 2, 1, 3};
+		auto Distinctified = Numbers | Distinct();
+
+		TestEqual("first pass", static_cast<int32>(std::ranges::distance(Distinctified)), 3);
+		TestEqual("second pass", static_cast<int32>(std::ranges::distance(Distinctified)), 3);
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
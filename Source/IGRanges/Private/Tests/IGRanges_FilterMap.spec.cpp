@@ -0,0 +1,124 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/FilterMap.h"
+#include "IGRanges/Select.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Optional.h"
+#include "Templates/SharedPointer.h"
+#include <ranges>
+#include <type_traits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesFilterMapSpec, "IG.Ranges.FilterMap", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesFilterMapSpec::Define()
+{
+	using namespace IG::Ranges;
+
+	It("empty", [this]() {
+		int32 NumCalls = 0;
+		const auto Results = std::ranges::empty_view<int32>() | FilterMap([&NumCalls](int32) -> const int32* {
+			++NumCalls;
+			return nullptr;
+		});
+
+		TestEqual("count", static_cast<int32>(std::ranges::distance(Results)), 0);
+		TestEqual("calls", NumCalls, 0);
+	});
+
+	It("pointers", [this]() {
+		const int32 Numbers[] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+		TArray<const int32*> Expected;
+		for (const int32& N : Numbers)
+		{
+			if (N % 3 != 0)
+			{
+				Expected.Emplace(&N);
+			}
+		}
+
+		TArray<const int32*> Actual;
+		for (const int32* X : Numbers | FilterMap([](const int32& N) { return (N % 3 != 0) ? &N : nullptr; }))
+		{
+			Actual.Emplace(X);
+		}
+
+		TestTrue("results", Actual == Expected);
+	});
+
+	It("shared_pointers", [this]() {
+		const TArray<TSharedPtr<int32>> Pointers = {MakeShared<int32>(1), nullptr, MakeShared<int32>(3), nullptr};
+		const auto Results = Pointers | FilterMap([](const TSharedPtr<int32>& P) { return P; });
+
+		TestEqual("count", static_cast<int32>(std::ranges::distance(Results)), 2);
+		for (const TSharedPtr<int32>& P : Results)
+		{
+			TestTrue("valid", P.IsValid());
+		}
+	});
+
+	It("optionals", [this]() {
+		const int32 Numbers[] = {1, 2, 3, 4, 5, 6, 7, 8};
+		const auto Halves = Numbers | FilterMap([](int32 N) { return (N % 2 == 0) ? TOptional<int32>(N / 2) : TOptional<int32>(); });
+
+		static_assert(std::is_same_v<std::ranges::range_value_t<decltype(Halves)>, int32>);
+
+		TArray<int32> Actual;
+		for (const int32 X : Halves)
+		{
+			Actual.Emplace(X);
+		}
+
+		TestEqual("results", Actual, TArray<int32>({1, 2, 3, 4}));
+	});
+
+	// The projection is invoked once per element, including for the elements that are kept & read.
+	It("single_evaluation", [this]() {
+		const int32 Numbers[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+		static constexpr int32 NumNumbers = UE_ARRAY_COUNT(Numbers);
+
+		int32 NumCalls = 0;
+		const auto Project = [&NumCalls](const int32& N) {
+			++NumCalls;
+			return (N % 2 == 0) ? &N : nullptr;
+		};
+
+		int32 Total = 0;
+		for (const int32* X : Numbers | FilterMap(Project))
+		{
+			Total += *X;
+		}
+
+		TestEqual("total", Total, 30);
+		TestEqual("FilterMap calls", NumCalls, NumNumbers);
+
+		NumCalls = 0;
+		Total = 0;
+		for (const int32* X : Numbers | SelectNonNull(Project))
+		{
+			Total += *X;
+		}
+
+		TestEqual("SelectNonNull total", Total, 30);
+		TestEqual("SelectNonNull calls", NumCalls, NumNumbers);
+	});
+
+	It("view", [this]() {
+		const int32 Numbers[] = {1, 2, 3, 4, 5, 6};
+		const auto Odds = Numbers | FilterMap([](const int32& N) { return (N % 2 != 0) ? &N : nullptr; });
+
+		static_assert(std::ranges::forward_range<decltype(Odds)>);
+		static_assert(std::ranges::common_range<decltype(Odds)>);
+
+		auto Copy = Odds;
+		TestEqual("count", static_cast<int32>(std::ranges::distance(Odds)), 3);
+		TestEqual("copy count", static_cast<int32>(std::ranges::distance(Copy)), 3);
+		TestTrue("first", *std::ranges::begin(Odds) == &Numbers[0]);
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
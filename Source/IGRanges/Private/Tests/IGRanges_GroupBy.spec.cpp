@@ -0,0 +1,82 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/GroupBy.h"
+#include "IGRanges/Where.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include <ranges>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesGroupBySpec, "IG.Ranges.GroupBy", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesGroupBySpec::Define()
+{
+	using namespace IG::Ranges;
+
+	struct FItem
+	{
+		FName Category;
+		float Weight = 0.0f;
+	};
+
+	static const FName Apples(TEXT("Apples"));
+	static const FName Pears(TEXT("Pears"));
+	static const FName Plums(TEXT("Plums"));
+
+	const auto MakeItems = []() {
+		return TArray<FItem>({{Apples, 1.0f}, {Pears, 4.0f}, {Apples, 3.0f}, {Plums, 2.0f}, {Apples, 2.0f}, {Pears, 0.5f}});
+	};
+
+	// `GroupBy` with an empty range produces an empty map.
+	It("empty", [this]() {
+		const TMap<int32, int32> TestMe = std::ranges::empty_view<int32>() | GroupBy([](int32 X) { return X % 3; }, Aggregators::Count());
+		TestEqual("count", TestMe.Num(), 0);
+	});
+
+	It("count", [this, MakeItems]() {
+		const TMap<FName, int32> TestMe = MakeItems() | GroupBy(&FItem::Category, Aggregators::Count());
+		TestEqual("groups", TestMe.Num(), 3);
+		TestEqual("apples", TestMe[Apples], 3);
+		TestEqual("pears", TestMe[Pears], 2);
+		TestEqual("plums", TestMe[Plums], 1);
+	});
+
+	It("sum", [this, MakeItems]() {
+		const TMap<FName, float> TestMe = MakeItems() | GroupBy(&FItem::Category, Aggregators::Sum(&FItem::Weight));
+		TestEqual("apples", TestMe[Apples], 6.0f);
+		TestEqual("pears", TestMe[Pears], 4.5f);
+		TestEqual("plums", TestMe[Plums], 2.0f);
+
+		const TArray<int32> Numbers = {1, 2, 3, 4, 5, 6, 7};
+		const TMap<bool, int32> Sums = Numbers | GroupBy([](int32 X) { return X % 2 == 0; }, Aggregators::Sum());
+		TestEqual("evens", Sums[true], 12);
+		TestEqual("odds", Sums[false], 16);
+	});
+
+	It("min_max", [this, MakeItems]() {
+		const TArray<FItem> Items = MakeItems();
+
+		const TMap<FName, float> Lightest = Items | GroupBy(&FItem::Category, Aggregators::Min(&FItem::Weight));
+		TestEqual("lightest apple", Lightest[Apples], 1.0f);
+		TestEqual("lightest pear", Lightest[Pears], 0.5f);
+
+		const TMap<FName, float> Heaviest = Items | GroupBy(&FItem::Category, Aggregators::Max(&FItem::Weight));
+		TestEqual("heaviest apple", Heaviest[Apples], 3.0f);
+		TestEqual("heaviest pear", Heaviest[Pears], 4.0f);
+	});
+
+	It("fold", [this, MakeItems]() {
+		const TMap<FName, FString> TestMe = MakeItems()
+										  | Where([](const FItem& Item) { return Item.Weight >= 1.0f; })
+										  | GroupBy(&FItem::Category, Aggregators::Fold(FString(), [](FString Acc, const FItem& Item) {
+												return Acc + FString::SanitizeFloat(Item.Weight, 0) + TEXT(";");
+											}));
+		TestEqual("groups", TestMe.Num(), 3);
+		TestEqual("apples", TestMe[Apples], FString(TEXT("1;3;2;")));
+		TestEqual("pears", TestMe[Pears], FString(TEXT("4;")));
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,94 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/IndexOf.h"
+#include "IGRanges/Where.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include <ranges>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesIndexOfSpec, "IG.Ranges.IndexOf", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesIndexOfSpec::Define()
+{
+	using namespace IG::Ranges;
+
+	It("empty", [this]() {
+		TestEqual("index", std::ranges::empty_view<int32>() | IndexOf(1), INDEX_NONE);
+		TestFalse("contains", std::ranges::empty_view<int32>() | Contains(1));
+		TestEqual("array index", TArray<int32>() | IndexOf(1), INDEX_NONE);
+	});
+
+	// Every position around the block boundaries, so that matches in both the blocks & the leftover elements are found.
+	It("contiguous", [this]() {
+		const int32 Sizes[] = {1, 2, 3, 63, 64, 65, 127, 128, 129, 200};
+		for (const int32 Num : Sizes)
+		{
+			TArray<int32> Numbers;
+			for (int32 i = 0; i < Num; ++i)
+			{
+				Numbers.Emplace(i * 10);
+			}
+
+			for (int32 i = 0; i < Num; ++i)
+			{
+				TestEqual("index", Numbers | IndexOf(i * 10), i);
+			}
+
+			TestEqual("missing", Numbers | IndexOf(5), INDEX_NONE);
+			TestTrue("contains", Numbers | Contains((Num - 1) * 10));
+			TestFalse("doesn't contain", Numbers | Contains(Num * 10));
+		}
+	});
+
+	It("first_match", [this]() {
+		TArray<uint8> Bytes;
+		for (int32 i = 0; i < 150; ++i)
+		{
+			Bytes.Emplace(static_cast<uint8>(i % 4));
+		}
+
+		Bytes[70] = 7;
+		Bytes[80] = 7;
+		TestEqual("first", Bytes | IndexOf(2), 2);
+		TestEqual("second block", Bytes | IndexOf(7), 70);
+	});
+
+	It("pointers_and_enums", [this]() {
+		enum class EColor : uint8
+		{
+			Red,
+			Green,
+			Blue,
+		};
+
+		const int32 SomeValues[] = {1, 2, 3};
+		const TArray<const int32*> Pointers = {&SomeValues[0], nullptr, &SomeValues[2]};
+		TestEqual("nullptr", Pointers | IndexOf(nullptr), 1);
+		TestTrue("contains", Pointers | Contains(&SomeValues[2]));
+		TestFalse("doesn't contain", Pointers | Contains(&SomeValues[1]));
+
+		const TArray<EColor> Colors = {EColor::Red, EColor::Red, EColor::Blue};
+		TestEqual("enum", Colors | IndexOf(EColor::Blue), 2);
+		TestFalse("doesn't contain enum", Colors | Contains(EColor::Green));
+	});
+
+	It("not_contiguous", [this]() {
+		const int32 SomeValues[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+		const auto IsEven = [](int32 X) {
+			return X % 2 == 0;
+		};
+
+		TestEqual("filtered index", SomeValues | Where(IsEven) | IndexOf(6), 2);
+		TestEqual("filtered missing", SomeValues | Where(IsEven) | IndexOf(5), INDEX_NONE);
+		TestTrue("filtered contains", SomeValues | Where(IsEven) | Contains(10));
+
+		const TArray<FString> Names = {TEXT("Rosie"), TEXT("Bob")};
+		TestEqual("strings", Names | IndexOf(TEXT("Bob")), 1);
+		TestTrue("strings contains", Names | Contains(FString(TEXT("Rosie"))));
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -4,6 +4,7 @@
 #include "IGRanges/Where.h"
 #include "IGRangesInternal.h"
 #include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -98,6 +99,44 @@ void FIGRangesIsChildOfSpec::Define()
 	It("yields_classes_of_specified_type (TSoftClassPtr)", [this]() {
 		TestPointers<TSoftClassPtr<const UStruct>>();
 	});
+
+	// Repeated classes are answered from the cache; the results must match chained `IsChildOf` checks.
+	It("is_child_of_any", [this]() {
+		using namespace IG::Ranges;
+
+		UClass* O = UObject::StaticClass();
+		UClass* F = UField::StaticClass();
+		UClass* E = UEnum::StaticClass();
+		UClass* S = UStruct::StaticClass();
+		UClass* C = UClass::StaticClass();
+		UClass* P = UPackage::StaticClass();
+		const UClass* SomeClasses[] = {nullptr, O, F, E, S, C, P, nullptr, C, O, F, F, E, E, P, S, C};
+
+		TArray<const UClass*> Expected;
+		for (const UClass* X : SomeClasses)
+		{
+			if (X != nullptr && (X->IsChildOf(E) || X->IsChildOf(C) || X->IsChildOf(P)))
+			{
+				Expected.Emplace(X);
+			}
+		}
+
+		TArray<const UClass*> Actual;
+		for (const UClass* X : SomeClasses | Where(Filters::IsChildOfAny({E, C, P})))
+		{
+			Actual.Emplace(X);
+		}
+
+		TestTrue("classes", Actual == Expected);
+
+		Actual.Reset();
+		for (const UClass* X : SomeClasses | Where(Filters::IsChildOfAny<UEnum, UClass, UPackage>()))
+		{
+			Actual.Emplace(X);
+		}
+
+		TestTrue("classes (template)", Actual == Expected);
+	});
 }
 
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,79 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/LoadAll.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+#include "UObject/SoftObjectPtr.h"
+#include <ranges>
+#include <type_traits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesLoadAllSpec, "IG.Ranges.LoadAll", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesLoadAllSpec::Define()
+{
+	using namespace IG::Ranges;
+
+	// Script classes are always loaded; the missing asset must not be loaded (or even looked for).
+	It("loaded_only", [this]() {
+		const TArray<TSoftClassPtr<UObject>> SoftClasses = {
+			TSoftClassPtr<UObject>(UObject::StaticClass()),
+			TSoftClassPtr<UObject>(),
+			TSoftClassPtr<UObject>(FSoftObjectPath(TEXT("/Engine/IGRangesTests/Missing.Missing_C"))),
+			TSoftClassPtr<UObject>(UPackage::StaticClass()),
+		};
+
+		const auto Loaded = SoftClasses | LoadedOnly();
+		static_assert(std::is_same_v<std::ranges::range_reference_t<decltype(Loaded)>, UClass*>);
+
+		TArray<UClass*> Actual;
+		for (UClass* Class : Loaded)
+		{
+			Actual.Emplace(Class);
+		}
+
+		TestTrue("loaded classes", Actual == TArray<UClass*>({UObject::StaticClass(), UPackage::StaticClass()}));
+	});
+
+	// Everything is already loaded, so the future is fulfilled immediately.
+	It("already_loaded", [this]() {
+		const TArray<FSoftObjectPath> Paths = {
+			FSoftObjectPath(UPackage::StaticClass()),
+			FSoftObjectPath(),
+			FSoftObjectPath(UObject::StaticClass()),
+		};
+
+		TFuture<TArray<UObject*>> Future = Paths | LoadAll();
+		if (TestTrue("ready", Future.IsReady()))
+		{
+			TestTrue("objects", Future.Get() == TArray<UObject*>({UPackage::StaticClass(), UObject::StaticClass()}));
+		}
+	});
+
+	// Engine content is available to content-only & cooked projects alike.
+	LatentIt("loads_assets", [this](const FDoneDelegate& Done) {
+		const TArray<TSoftObjectPtr<UObject>> SoftObjects = {
+			TSoftObjectPtr<UObject>(FSoftObjectPath(TEXT("/Engine/EngineResources/DefaultTexture.DefaultTexture"))),
+			TSoftObjectPtr<UObject>(),
+			TSoftObjectPtr<UObject>(UObject::StaticClass()),
+			TSoftObjectPtr<UObject>(FSoftObjectPath(TEXT("/Engine/EngineResources/DefaultTexture.DefaultTexture"))),
+		};
+
+		(SoftObjects | LoadAll()).Then([this, Done](TFuture<TArray<UObject*>> Future) {
+			const TArray<UObject*> Objects = Future.Get();
+			if (TestEqual("count", Objects.Num(), 3))
+			{
+				TestEqual("texture", Objects[0]->GetFName(), FName(TEXT("DefaultTexture")));
+				TestTrue("class", Objects[1] == UObject::StaticClass());
+				TestTrue("same texture", Objects[0] == Objects[2]);
+			}
+
+			Done.Execute();
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
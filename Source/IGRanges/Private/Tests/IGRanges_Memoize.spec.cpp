@@ -0,0 +1,97 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/Memoize.h"
+#include "IGRanges/Select.h"
+#include "IGRanges/Where.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include <ranges>
+#include <type_traits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesMemoizeSpec, "IG.Ranges.Memoize", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesMemoizeSpec::Define()
+{
+	using namespace IG::Ranges;
+
+	// Without `Memoize`, the projection is invoked by the predicate & again when the element is read.
+	It("single_evaluation", [this]() {
+		const TArray<int32> Numbers = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+		int32 NumCalls = 0;
+		const auto Square = [&NumCalls](int32 N) {
+			++NumCalls;
+			return N * N;
+		};
+
+		int32 Total = 0;
+		for (const int32 X : Numbers | Select(Square) | Where([](int32 N) { return N % 2 == 0; }))
+		{
+			Total += X;
+		}
+
+		TestEqual("unmemoized total", Total, 220);
+		TestEqual("unmemoized calls", NumCalls, 15);
+
+		NumCalls = 0;
+		Total = 0;
+		for (const int32 X : Numbers | Select(Square) | Memoize() | Where([](int32 N) { return N % 2 == 0; }))
+		{
+			Total += X;
+		}
+
+		TestEqual("memoized total", Total, 220);
+		TestEqual("memoized calls", NumCalls, 10);
+	});
+
+	// Elements that are never dereferenced are never computed.
+	It("lazy", [this]() {
+		const TArray<int32> Numbers = {1, 2, 3, 4, 5};
+
+		int32 NumCalls = 0;
+		const auto Memoized = Numbers | Select([&NumCalls](int32 N) { ++NumCalls; return N + 1; }) | Memoize();
+
+		TestEqual("count", static_cast<int32>(std::ranges::distance(Memoized)), 5);
+		TestEqual("calls", NumCalls, 0);
+	});
+
+	It("categories", [this]() {
+		const TArray<int32> Numbers = {1, 2, 3, 4, 5};
+		const auto Memoized = Numbers | Select([](int32 N) { return N * 10; }) | Memoize();
+
+		using MemoizedType = decltype(Memoized);
+		static_assert(std::ranges::random_access_range<MemoizedType>);
+		static_assert(std::ranges::sized_range<MemoizedType>);
+		static_assert(std::ranges::common_range<MemoizedType>);
+		static_assert(std::is_same_v<std::ranges::range_reference_t<MemoizedType>, int32>);
+
+		using FilteredType = decltype(Numbers | Select([](int32 N) { return N; }) | Where([](int32 N) { return N > 0; }) | Memoize());
+		static_assert(std::ranges::bidirectional_range<FilteredType>);
+		static_assert(!std::ranges::random_access_range<FilteredType>);
+
+		TestEqual("size", static_cast<int32>(std::ranges::size(Memoized)), 5);
+		TestEqual("index", Memoized[3], 40);
+
+		TArray<int32> Reversed;
+		for (const int32 X : Memoized | std::views::reverse)
+		{
+			Reversed.Emplace(X);
+		}
+
+		TestEqual("reversed", Reversed, TArray<int32>({50, 40, 30, 20, 10}));
+	});
+
+	// Ranges of references have nothing to cache & are passed through unchanged.
+	It("references", [this]() {
+		const TArray<int32> Numbers = {1, 2, 3};
+		const auto Memoized = Numbers | Memoize();
+
+		static_assert(std::is_same_v<std::ranges::range_reference_t<decltype(Memoized)>, const int32&>);
+		TestTrue("same elements", &*std::ranges::begin(Memoized) == &Numbers[0]);
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -1,5 +1,6 @@
 ﻿// Copyright Ian Good
 
+#include "IGRanges/CustomizationPoints.h"
 #include "IGRanges/NonNull.h"
 #include "IGRangesInternal.h"
 #include "Misc/AutomationTest.h"
@@ -148,6 +149,33 @@ void FIGRangesNonNullSpec::Define()
 
 		TestRefs(SomeWeakPointers);
 	});
+
+	// `NonNullRef` keeps weak pointers' objects alive while they're being referred to.
+	It("weak_pointers_stay_pinned", [this]() {
+		using namespace IG::Ranges;
+
+		TArray<TSharedPtr<int32>> Owners = {MakeShared<int32>(1), MakeShared<int32>(2), MakeShared<int32>(3)};
+		TArray<TWeakPtr<int32>> WeakPointers;
+		for (const TSharedPtr<int32>& Owner : Owners)
+		{
+			WeakPointers.Emplace(Owner);
+		}
+
+		int32 i = 0;
+		for (const int32& X : WeakPointers | NonNullRef())
+		{
+			Owners[i++].Reset();
+			TestTrue("still alive", WeakPointers[i - 1].IsValid());
+			TestEqual("pinned element", X, i);
+		}
+
+		TestEqual("count", i, 3);
+		TestEqual("released count", static_cast<int32>(std::ranges::distance(WeakPointers | NonNullRef())), 0);
+
+		// Reversing would yield references through temporary iterators that have already released their pins.
+		static_assert(std::ranges::forward_range<decltype(WeakPointers | NonNullRef())>);
+		static_assert(!std::ranges::bidirectional_range<decltype(WeakPointers | NonNullRef())>);
+	});
 }
 
 #endif // WITH_DEV_AUTOMATION_TESTS
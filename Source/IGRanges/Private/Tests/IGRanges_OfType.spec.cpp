@@ -1,10 +1,14 @@
 ﻿// Copyright Ian Good
 
+#include "IGRanges/CustomizationPoints.h"
 #include "IGRanges/OfType.h"
 #include "IGRangesInternal.h"
 #include "Misc/AutomationTest.h"
 #include "UObject/MetaData.h"
 #include "UObject/Package.h"
+#include <ranges>
+#include <type_traits>
+#include <utility>
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -199,6 +203,113 @@ void FIGRangesOfTypeSpec::Define()
 	It("yields_objects_of_specified_class (TWeakObjectPtr)", [this]() {
 		TestPointersIsA<TWeakObjectPtr<const UObject>>();
 	});
+
+	// Runs of objects with the same class reuse the previous class's result, which must not leak into the next run.
+	It("runs_of_same_class", [this]() {
+		const UObject* A = GetDefault<UObject>();
+		const UObject* B = GetDefault<UClass>();
+		const UObject* C = GetDefault<UPackage>();
+		const UObject* D = GetDefault<UMetaData>();
+		const UObject* SomePointers[] = {A, A, D, D, D, nullptr, D, B, B, C, D, nullptr, nullptr, A};
+
+		TestPointersOfType<const UMetaData>(SomePointers);
+		TestPointersOfType<const UPackage>(SomePointers);
+		TestRefsOfType<const UMetaData>(SomePointers);
+		TestPointersIsA(SomePointers, UMetaData::StaticClass());
+		TestPointersIsA(SomePointers, UObject::StaticClass());
+	});
+
+	It("of_any_type", [this]() {
+		using namespace IG::Ranges;
+
+		const UObject* A = GetDefault<UObject>();
+		const UObject* B = GetDefault<UClass>();
+		const UObject* C = GetDefault<UPackage>();
+		const UObject* D = GetDefault<UMetaData>();
+		const UObject* SomePointers[] = {A, A, D, D, nullptr, D, B, B, C, D, nullptr, A, C};
+
+		TArray<const UObject*> Expected;
+		for (const UObject* X : SomePointers)
+		{
+			if (X != nullptr && (X->IsA<UPackage>() || X->IsA<UMetaData>()))
+			{
+				Expected.Emplace(X);
+			}
+		}
+
+		TArray<const UObject*> Actual;
+		for (const UObject* X : SomePointers | OfAnyType<UPackage, UMetaData>())
+		{
+			Actual.Emplace(X);
+		}
+
+		TestTrue("objects of any type", Actual == Expected);
+
+		TArray<TWeakObjectPtr<const UObject>> WeakPointers;
+		for (const UObject* X : SomePointers)
+		{
+			WeakPointers.Emplace(X);
+		}
+
+		TestEqual("weak count", static_cast<int32>(std::ranges::distance(WeakPointers | OfAnyType<UPackage, UMetaData>())), Expected.Num());
+	});
+
+	// The view yields the results that it tested, so it can be iterated (even as const) & copied like other views.
+	It("view", [this]() {
+		using namespace IG::Ranges;
+
+		const UObject* A = GetDefault<UObject>();
+		const UObject* D = GetDefault<UMetaData>();
+		const TArray<const UObject*> SomePointers = {nullptr, A, D, D, nullptr, A, D};
+
+		const auto View = SomePointers | OfType<UMetaData>();
+		static_assert(std::ranges::forward_range<decltype(View)> && std::ranges::common_range<decltype(View)>);
+		static_assert(std::is_same_v<std::ranges::range_reference_t<decltype(View)>, const UMetaData*>);
+
+		TestEqual("count", static_cast<int32>(std::ranges::distance(View)), 3);
+		TestTrue("first", *View.begin() == D);
+
+		const auto Copy = View;
+		TestEqual("copy count", static_cast<int32>(std::ranges::distance(Copy)), 3);
+
+		int32 NumElements = 0;
+		for (const UObject& Obj : std::as_const(SomePointers) | OfTypeRef<UMetaData>())
+		{
+			TestTrue("ref", &Obj == D);
+			++NumElements;
+		}
+
+		TestEqual("ref count", NumElements, 3);
+	});
+
+	// Views of bidirectional ranges can be reversed.
+	It("reverse", [this]() {
+		using namespace IG::Ranges;
+
+		const UObject* A = GetDefault<UObject>();
+		const UObject* B = GetDefault<UPackage>();
+		const UObject* C = GetDefault<UMetaData>();
+		const TArray<const UObject*> SomePointers = {nullptr, C, A, B, nullptr, C, A, B, C, nullptr};
+
+		const auto View = SomePointers | OfType<UObject>();
+		static_assert(std::ranges::bidirectional_range<decltype(View)>);
+
+		TArray<const UObject*> Expected;
+		for (const UObject* X : View)
+		{
+			Expected.Insert(X, 0);
+		}
+
+		TArray<const UObject*> Actual;
+		for (const UObject* X : View | std::views::reverse)
+		{
+			Actual.Emplace(X);
+		}
+
+		TestEqual("count", Actual.Num(), 7);
+		TestTrue("reversed", Actual == Expected);
+		TestTrue("reversed type", *(SomePointers | OfType<UPackage>() | std::views::reverse).begin() == B);
+	});
 }
 
 #endif // WITH_DEV_AUTOMATION_TESTS
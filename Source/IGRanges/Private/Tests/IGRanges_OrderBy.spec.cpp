@@ -0,0 +1,81 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/FirstOrDefault.h"
+#include "IGRanges/OrderBy.h"
+#include "IGRanges/Select.h"
+#include "IGRanges/ToArray.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include <functional>
+#include <ranges>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesOrderBySpec, "IG.Ranges.OrderBy", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+struct FOrderByItem
+{
+	int32 Category = 0;
+	int32 Weight = 0;
+	int32 Id = 0;
+};
+
+template <typename RangeType>
+static TArray<int32> OrderedIds(RangeType&& Range)
+{
+	return Range | IG::Ranges::Select(&FOrderByItem::Id) | IG::Ranges::ToArray();
+}
+
+void FIGRangesOrderBySpec::Define()
+{
+	using namespace IG::Ranges;
+
+	It("empty", [this]() {
+		const TArray<int32> Empty;
+		TestTrue("empty", (Empty | OrderBy(std::identity()) | ToArray()).IsEmpty());
+	});
+
+	It("ascending_descending", [this]() {
+		const TArray<int32> Numbers = {5, 3, 9, 1, 7, 3, 8};
+		TestEqual("ascending", Numbers | OrderBy(std::identity()) | ToArray(), TArray<int32>({1, 3, 3, 5, 7, 8, 9}));
+		TestEqual("descending", Numbers | OrderByDescending(std::identity()) | ToArray(), TArray<int32>({9, 8, 7, 5, 3, 3, 1}));
+	});
+
+	// Elements with equivalent keys keep their original order.
+	It("stable", [this]() {
+		const TArray<FOrderByItem> Items = {{2, 5, 0}, {1, 3, 1}, {2, 5, 2}, {1, 4, 3}, {2, 1, 4}, {1, 3, 5}};
+		TestEqual("ascending", OrderedIds(Items | OrderBy(&FOrderByItem::Category)), TArray<int32>({1, 3, 5, 0, 2, 4}));
+		TestEqual("descending", OrderedIds(Items | OrderByDescending(&FOrderByItem::Category)), TArray<int32>({0, 2, 4, 1, 3, 5}));
+	});
+
+	It("then_by", [this]() {
+		const TArray<FOrderByItem> Items = {{2, 5, 0}, {1, 3, 1}, {2, 5, 2}, {1, 4, 3}, {2, 1, 4}, {1, 3, 5}};
+		TestEqual("then by", OrderedIds(Items | OrderBy(&FOrderByItem::Category) | ThenBy(&FOrderByItem::Weight)), TArray<int32>({1, 5, 3, 4, 0, 2}));
+		TestEqual("then by descending", OrderedIds(Items | OrderBy(&FOrderByItem::Category) | ThenByDescending(&FOrderByItem::Weight)), TArray<int32>({3, 1, 5, 0, 2, 4}));
+		TestEqual("then by twice", OrderedIds(Items | OrderByDescending(&FOrderByItem::Category) | ThenBy(&FOrderByItem::Weight) | ThenByDescending(&FOrderByItem::Id)), TArray<int32>({4, 2, 0, 5, 1, 3}));
+	});
+
+	// Nothing happens until the view is iterated, & each key is computed once no matter how much of it is read.
+	It("lazy", [this]() {
+		const TArray<int32> Numbers = {5, 3, 9, 1, 7, 3, 8};
+
+		int32 NumCalls = 0;
+		auto Ordered = Numbers | OrderBy([&NumCalls](int32 N) { ++NumCalls; return -N; });
+		TestEqual("calls before iterating", NumCalls, 0);
+
+		TestEqual("first", Ordered | FirstOrDefault(), 9);
+		TestEqual("calls after first", NumCalls, 7);
+
+		TArray<int32> FirstThree;
+		for (const int32 X : Ordered | std::views::take(3))
+		{
+			FirstThree.Emplace(X);
+		}
+
+		TestEqual("first three", FirstThree, TArray<int32>({9, 8, 7}));
+		TestEqual("size", static_cast<int32>(std::ranges::size(Ordered)), 7);
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,84 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/ParallelReduce.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include <functional>
+#include <numeric>
+#include <ranges>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesParallelReduceSpec, "IG.Ranges.ParallelReduce", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesParallelReduceSpec::Define()
+{
+	using namespace IG::Ranges;
+	using namespace IG::Ranges::Tests;
+
+	static const TArray<int32>& SomeValues = GetParallelTestValues();
+
+	static const auto IsEven = [](int32 X) {
+		return X % 2 == 0;
+	};
+
+	It("empty", [this]() {
+		const TArray<int32> Empty;
+		TestEqual("sum", Empty | ParallelSum(ManyTasks), 0);
+		TestEqual("count", Empty | ParallelCount(IsEven, ManyTasks), 0);
+		TestEqual("accumulate", Empty | ParallelAccumulate(int64{}, std::plus<>(), std::plus<>(), ManyTasks), int64{});
+	});
+
+	It("single", [this]() {
+		const TArray<int32> Single = {123};
+		TestEqual("sum", Single | ParallelSum(ManyTasks), 123);
+		TestEqual("count", Single | ParallelCount(IsEven, ManyTasks), 0);
+		TestEqual("accumulate", Single | ParallelAccumulate(int64{}, std::plus<>(), std::plus<>(), ManyTasks), int64{123});
+	});
+
+	// Parallel results match their serial counterparts regardless of how many tasks are used.
+	It("many", [this]() {
+		const int32 ExpectedSum = std::accumulate(SomeValues.GetData(), SomeValues.GetData() + SomeValues.Num(), 0);
+		const int32 ExpectedCount = static_cast<int32>(std::ranges::count_if(SomeValues, IsEven));
+
+		ForEachTaskCount([&](int32 MaxTasks, const FParallelOptions& Options) {
+			TestEqual(FString::Printf(TEXT("sum (%d tasks)"), MaxTasks), SomeValues | ParallelSum(Options), ExpectedSum);
+			TestEqual(FString::Printf(TEXT("count (%d tasks)"), MaxTasks), SomeValues | ParallelCount(IsEven, Options), ExpectedCount);
+			TestEqual(FString::Printf(TEXT("accumulate (%d tasks)"), MaxTasks), SomeValues | ParallelAccumulate(0, std::plus<>(), std::plus<>(), Options), ExpectedSum);
+		});
+	});
+
+	It("many_transformed", [this]() {
+		const auto Square = [](int32 X) {
+			return static_cast<int64>(X) * X;
+		};
+
+		int64 ExpectedSum = 0;
+		for (const int32 X : SomeValues)
+		{
+			ExpectedSum += Square(X);
+		}
+
+		TestEqual("sum", SomeValues | ParallelSum(Square, ManyTasks), ExpectedSum);
+	});
+
+	// Partial results are combined in source order, so non-commutative (but associative) combiners work.
+	It("preserves_order", [this]() {
+		const auto Fold = [](FString Acc, int32 Elem) {
+			Acc.AppendInt(Elem);
+			return Acc;
+		};
+
+		FString Expected;
+		for (const int32 X : SomeValues)
+		{
+			Expected = Fold(MoveTemp(Expected), X);
+		}
+
+		const FString Actual = SomeValues | ParallelAccumulate(FString(), Fold, std::plus<>(), ManyTasks);
+		TestEqual("accumulate", Actual, Expected);
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
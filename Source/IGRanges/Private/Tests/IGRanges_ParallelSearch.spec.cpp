@@ -0,0 +1,105 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/ParallelSearch.h"
+#include "IGRanges/Select.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include <algorithm>
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesParallelSearchSpec, "IG.Ranges.ParallelSearch", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesParallelSearchSpec::Define()
+{
+	using namespace IG::Ranges;
+	using namespace IG::Ranges::Tests;
+
+	static const TArray<int32>& SomeValues = GetParallelTestValues();
+
+	static const auto IsTwelve = [](int32 X) {
+		return X == 12;
+	};
+
+	It("empty", [this]() {
+		const TArray<int32> Empty;
+		TestTrue("all", Empty | ParallelAll(IsTwelve, ManyTasks));
+		TestFalse("any", Empty | ParallelAny(IsTwelve, ManyTasks));
+		TestTrue("none", Empty | ParallelNone(IsTwelve, ManyTasks));
+		TestEqual("first_or_default", Empty | ParallelFirstOrDefault(IsTwelve, ManyTasks), 0);
+	});
+
+	It("default_predicates", [this]() {
+		const TArray<int32> Values = {2, 1, 0, 3};
+		TestFalse("all", Values | ParallelAll());
+		TestTrue("any", Values | ParallelAny());
+		TestFalse("none", Values | ParallelNone());
+		TestEqual("first_or_default", Values | ParallelFirstOrDefault(), 2);
+
+		TestFalse("all (options)", Values | ParallelAll(ManyTasks));
+		TestTrue("any (options)", Values | ParallelAny(ManyTasks));
+		TestFalse("none (options)", Values | ParallelNone(ManyTasks));
+		TestEqual("first_or_default (options)", Values | ParallelFirstOrDefault(ManyTasks), 2);
+		TestTrue("all set (options)", SomeValues | Select([](int32 X) { return X + 1; }) | ParallelAll({.MaxTasks = 4, .MinElementsPerTask = 1}));
+	});
+
+	// Parallel results match their serial counterparts regardless of how many tasks are used.
+	It("many", [this]() {
+		const auto IsSmall = [](int32 X) {
+			return X < 13;
+		};
+		const auto IsNegative = [](int32 X) {
+			return X < 0;
+		};
+
+		ForEachTaskCount([&](int32 MaxTasks, const FParallelOptions& Options) {
+			TestTrue(FString::Printf(TEXT("all (%d tasks)"), MaxTasks), SomeValues | ParallelAll(IsSmall, Options));
+			TestFalse(FString::Printf(TEXT("not all (%d tasks)"), MaxTasks), SomeValues | ParallelAll(IsTwelve, Options));
+			TestTrue(FString::Printf(TEXT("any (%d tasks)"), MaxTasks), SomeValues | ParallelAny(IsTwelve, Options));
+			TestFalse(FString::Printf(TEXT("not any (%d tasks)"), MaxTasks), SomeValues | ParallelAny(IsNegative, Options));
+			TestTrue(FString::Printf(TEXT("none (%d tasks)"), MaxTasks), SomeValues | ParallelNone(IsNegative, Options));
+			TestFalse(FString::Printf(TEXT("not none (%d tasks)"), MaxTasks), SomeValues | ParallelNone(IsTwelve, Options));
+		});
+	});
+
+	// Whichever task finds a match first, the result is the match with the lowest index.
+	It("first_or_default_lowest_index", [this]() {
+		TArray<int32> Indices;
+		for (int32 i = 0; i < 1000; ++i)
+		{
+			Indices.Emplace(i);
+		}
+
+		// Matches in every chunk, so tasks race to publish theirs.
+		const auto IsMultipleOf37 = [](int32 X) {
+			return X > 0 && X % 37 == 0;
+		};
+
+		ForEachTaskCount([&](int32 MaxTasks, const FParallelOptions& Options) {
+			TestEqual(FString::Printf(TEXT("found (%d tasks)"), MaxTasks), Indices | ParallelFirstOrDefault(IsMultipleOf37, Options), 37);
+			TestEqual(FString::Printf(TEXT("not found (%d tasks)"), MaxTasks), Indices | ParallelFirstOrDefault([](int32 X) { return X < 0; }, Options), 0);
+		});
+	});
+
+	It("first_or_default_transformed", [this]() {
+		const int32 Expected = 2 * *std::ranges::find(SomeValues, 12);
+		TestEqual("result", SomeValues | Select([](int32 X) { return X * 2; }) | ParallelFirstOrDefault([](int32 X) { return X == 24; }, ManyTasks), Expected);
+	});
+
+	// Once the answer is known, tasks stop invoking the predicate.
+	It("short_circuits", [this]() {
+		std::atomic<int32> NumCalls = 0;
+		const auto CountCalls = [&NumCalls](int32) {
+			++NumCalls;
+			return true;
+		};
+
+		const bool bResult = SomeValues | ParallelAny(CountCalls, ManyTasks);
+		TestTrue("result", bResult);
+		TestTrue("calls", NumCalls.load() <= ManyTasks.MaxTasks); // At most one call per task.
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
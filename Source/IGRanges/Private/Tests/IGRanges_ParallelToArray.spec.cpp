@@ -0,0 +1,62 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/ParallelToArray.h"
+#include "IGRanges/Select.h"
+#include "IGRanges/ToArray.h"
+#include "IGRanges/Where.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include <ranges>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesParallelToArraySpec, "IG.Ranges.ParallelToArray", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesParallelToArraySpec::Define()
+{
+	using namespace IG::Ranges;
+	using namespace IG::Ranges::Tests;
+
+	static const TArray<int32>& SomeValues = GetParallelTestValues();
+
+	static const auto IsEven = [](int32 X) {
+		return X % 2 == 0;
+	};
+
+	static const auto ToName = [](int32 X) {
+		return FString::FromInt(X);
+	};
+
+	It("empty", [this]() {
+		const TArray<int32> Empty;
+		TestTrue("no pipeline", (Empty | ParallelToArray(ManyTasks)).IsEmpty());
+		TestTrue("pipeline", (Empty | ParallelToArray(Where(IsEven) | Select(ToName), ManyTasks)).IsEmpty());
+	});
+
+	It("no_pipeline", [this]() {
+		TestEqual("array", SomeValues | ParallelToArray(ManyTasks), SomeValues);
+		TestEqual("select", SomeValues | Select(ToName) | ParallelToArray(ManyTasks), SomeValues | Select(ToName) | ToArray());
+	});
+
+	// Parallel results match their serial counterparts (in the same order) regardless of how many tasks are used.
+	It("pipeline", [this]() {
+		const TArray<FString> Expected = SomeValues | Where(IsEven) | Select(ToName) | ToArray();
+
+		ForEachTaskCount([&](int32 MaxTasks, const FParallelOptions& Options) {
+			TestEqual(FString::Printf(TEXT("filtered (%d tasks)"), MaxTasks), SomeValues | ParallelToArray(Where(IsEven) | Select(ToName), Options), Expected);
+		});
+	});
+
+	// Some tasks produce no elements at all.
+	It("sparse", [this]() {
+		const TArray<int32> Expected = {1000, 2000};
+		const auto IsMultipleOfThousand = [](int32 X) {
+			return X % 1000 == 0;
+		};
+
+		TestEqual("sparse", std::views::iota(1, 2500) | ParallelToArray(Where(IsMultipleOfThousand), ManyTasks), Expected);
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
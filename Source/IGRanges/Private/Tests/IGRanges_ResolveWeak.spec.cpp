@@ -0,0 +1,75 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/OfType.h"
+#include "IGRanges/ResolveWeak.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/MetaData.h"
+#include "UObject/Package.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include <ranges>
+#include <type_traits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesResolveWeakSpec, "IG.Ranges.ResolveWeak", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesResolveWeakSpec::Define()
+{
+	using namespace IG::Ranges;
+
+	It("resolves_weak_pointers", [this]() {
+		const UObject* A = GetDefault<UObject>();
+		const UObject* B = GetDefault<UPackage>();
+		const UObject* C = GetDefault<UMetaData>();
+		const TArray<TWeakObjectPtr<const UObject>> WeakPointers = {nullptr, A, B, nullptr, C, A};
+
+		const auto Resolved = WeakPointers | ResolveWeak();
+		static_assert(std::is_same_v<std::ranges::range_reference_t<decltype(Resolved)>, const UObject*>);
+
+		TArray<const UObject*> Actual;
+		for (const UObject* X : Resolved)
+		{
+			Actual.Emplace(X);
+		}
+
+		TestTrue("resolved", Actual == TArray<const UObject*>({A, B, C, A}));
+	});
+
+	It("drops_stale_pointers", [this]() {
+		UObject* Alive = NewObject<UObject>();
+		UObject* Stale = NewObject<UObject>();
+		const TArray<TWeakObjectPtr<UObject>> WeakPointers = {Stale, Alive, Stale};
+
+		Stale->MarkAsGarbage();
+
+		TArray<UObject*> Actual;
+		for (UObject* X : WeakPointers | ResolveWeak())
+		{
+			Actual.Emplace(X);
+		}
+
+		TestTrue("resolved", Actual == TArray<UObject*>({Alive}));
+	});
+
+	// Downstream adapters receive raw pointers.
+	It("of_type", [this]() {
+		const UObject* A = GetDefault<UObject>();
+		const UObject* B = GetDefault<UMetaData>();
+		const TArray<TWeakObjectPtr<const UObject>> WeakPointers = {A, nullptr, B, B, A};
+
+		TArray<const UMetaData*> Actual;
+		for (const UMetaData* X : WeakPointers | ResolveWeak() | OfType<UMetaData>())
+		{
+			Actual.Emplace(X);
+		}
+
+		if (TestEqual("count", Actual.Num(), 2))
+		{
+			TestTrue("of type", Actual[0] == B && Actual[1] == B);
+		}
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,47 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/Skip.h"
+#include "IGRanges/ToArray.h"
+#include "IGRanges/Where.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include <ranges>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesSkipSpec, "IG.Ranges.Skip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesSkipSpec::Define()
+{
+	using namespace IG::Ranges;
+
+	It("skip", [this]() {
+		const TArray<int32> Numbers = {1, 2, 3, 4, 5};
+		TestEqual("some", Numbers | Skip(3) | ToArray(), TArray<int32>({4, 5}));
+		TestTrue("all", (Numbers | Skip(10) | ToArray()).IsEmpty());
+		TestEqual("none", Numbers | Skip(0) | ToArray(), Numbers);
+		TestEqual("negative", Numbers | Skip(-1) | ToArray(), Numbers);
+		TestEqual("filtered", Numbers | Where([](int32 N) { return N % 2 == 1; }) | Skip(1) | ToArray(), TArray<int32>({3, 5}));
+	});
+
+	// Skipping elements of a sized random access sequence doesn't iterate them.
+	It("random_access", [this]() {
+		const TArray<int32> Numbers = {1, 2, 3, 4, 5};
+		const auto Skipped = Numbers | Skip(2);
+
+		static_assert(std::ranges::random_access_range<decltype(Skipped)>);
+		static_assert(std::ranges::sized_range<decltype(Skipped)>);
+		TestEqual("size", static_cast<int32>(std::ranges::size(Skipped)), 3);
+		TestTrue("same elements", &*std::ranges::begin(Skipped) == &Numbers[2]);
+	});
+
+	It("skip_while", [this]() {
+		const TArray<int32> Numbers = {1, 2, 3, 10, 4, 5};
+		TestEqual("some", Numbers | SkipWhile([](int32 N) { return N < 5; }) | ToArray(), TArray<int32>({10, 4, 5}));
+		TestTrue("all", (Numbers | SkipWhile([](int32 N) { return N > 0; }) | ToArray()).IsEmpty());
+		TestEqual("none", Numbers | SkipWhile([](int32 N) { return N > 1; }) | ToArray(), Numbers);
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -1,5 +1,6 @@
 ﻿// Copyright Ian Good
 
+#include "IGRanges/CustomizationPoints.h"
 #include "IGRanges/Sum.h"
 #include "IGRangesInternal.h"
 #include "Misc/AutomationTest.h"
@@ -93,6 +94,69 @@ void FIGRangesSumSpec::Define()
 		const int32 ActualSum = SomeValues | Sum(&FString::Len);
 		TestEqual("sum int32", ActualSum, ExpectedSum);
 	});
+
+	// Sizes around the unrolled loops' boundaries so that both the blocks & the leftover elements are summed.
+	// Values are small integers so that floating-point sums are exact regardless of the order they're added in.
+	It("contiguous", [this]() {
+		const int32 Sizes[] = {1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 1001};
+
+		const auto CheckSums = [this, &Sizes](const TCHAR* What, auto MakeValue) {
+			using T = decltype(MakeValue(0));
+			for (const int32 Num : Sizes)
+			{
+				TArray<T> Values;
+				for (int32 i = 0; i < Num; ++i)
+				{
+					Values.Emplace(MakeValue(i));
+				}
+
+				T ExpectedSum = Values[0];
+				for (int32 i = 1; i < Num; ++i)
+				{
+					ExpectedSum += Values[i];
+				}
+
+				const T ActualSum = Values | Sum();
+				TestEqual(*FString::Printf(TEXT("%s (%d elements)"), What, Num), ActualSum, ExpectedSum);
+			}
+		};
+
+		CheckSums(TEXT("int32"), [](int32 i) { return i % 7 - 3; });
+		CheckSums(TEXT("int64"), [](int32 i) { return static_cast<int64>(i) << 32; });
+		CheckSums(TEXT("float"), [](int32 i) { return static_cast<float>(i % 5); });
+		CheckSums(TEXT("double"), [](int32 i) { return static_cast<double>(i % 5) - 2.0; });
+		CheckSums(TEXT("FVector"), [](int32 i) { return FVector(i, -2 * i, i % 3); });
+		CheckSums(TEXT("FVector3f"), [](int32 i) { return FVector3f(static_cast<float>(i % 4), static_cast<float>(i % 5), static_cast<float>(-(i % 6))); });
+		CheckSums(TEXT("FVector4"), [](int32 i) { return FVector4(i, i % 2, -i, 1.0); });
+	});
+
+	It("contiguous_transformed", [this]() {
+		struct FBar
+		{
+			float Weight = 0.0f;
+			FVector Position;
+		};
+
+		TArray<FBar> SomeStructs;
+		float ExpectedWeight = 0.0f;
+		FVector ExpectedPosition = FVector::ZeroVector;
+		for (int32 i = 0; i < 37; ++i)
+		{
+			SomeStructs.Emplace(FBar{static_cast<float>(i % 4), FVector(i, 1.0, -i)});
+			ExpectedWeight += SomeStructs.Last().Weight;
+			ExpectedPosition += SomeStructs.Last().Position;
+		}
+
+		TestEqual("sum member", SomeStructs | Sum(&FBar::Weight), ExpectedWeight);
+		TestEqual("sum lambda", SomeStructs | Sum([](const FBar& B) { return B.Position; }), ExpectedPosition);
+		TestEqual("sum empty", TArray<FBar>() | Sum(&FBar::Weight), 0.0f);
+
+		// The projection is invoked once per element, in order.
+		int32 NumCalls = 0;
+		const int32 Indices = SomeStructs | Sum([&NumCalls](const FBar&) { return NumCalls++; });
+		TestEqual("calls", NumCalls, SomeStructs.Num());
+		TestEqual("indices", Indices, 36 * 37 / 2);
+	});
 }
 
 #endif // WITH_DEV_AUTOMATION_TESTS
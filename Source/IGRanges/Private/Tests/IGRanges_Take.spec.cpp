@@ -0,0 +1,60 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/Reserve.h"
+#include "IGRanges/Select.h"
+#include "IGRanges/Take.h"
+#include "IGRanges/ToArray.h"
+#include "IGRanges/Where.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include <ranges>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesTakeSpec, "IG.Ranges.Take", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesTakeSpec::Define()
+{
+	using namespace IG::Ranges;
+
+	It("take", [this]() {
+		const TArray<int32> Numbers = {1, 2, 3, 4, 5};
+		TestEqual("some", Numbers | Take(3) | ToArray(), TArray<int32>({1, 2, 3}));
+		TestEqual("all", Numbers | Take(10) | ToArray(), Numbers);
+		TestTrue("none", (Numbers | Take(0) | ToArray()).IsEmpty());
+		TestTrue("negative", (Numbers | Take(-1) | ToArray()).IsEmpty());
+	});
+
+	// Sized sequences stay sized, so `ToArray` reserves exactly the number of elements taken.
+	It("sized", [this]() {
+		const TArray<int32> Numbers = {1, 2, 3, 4, 5};
+		TestEqual("fewer", static_cast<int32>(std::ranges::size(Numbers | Take(3))), 3);
+		TestEqual("more", static_cast<int32>(std::ranges::size(Numbers | Take(10))), 5);
+		TestEqual("projected", static_cast<int32>(std::ranges::size(Numbers | Select([](int32 N) { return N * 2; }) | Take(2))), 2);
+		TestEqual("filtered bound", static_cast<int32>(ReserveUpperBound.GetReserveCount(Numbers | Where([](int32 N) { return N > 1; }) | Take(2))), 2);
+	});
+
+	// Filters upstream aren't invoked for elements after the last one that's taken.
+	It("short_circuit", [this]() {
+		const TArray<int32> Numbers = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+		int32 NumCalls = 0;
+		const auto IsEven = [&NumCalls](int32 N) {
+			++NumCalls;
+			return N % 2 == 0;
+		};
+
+		TestEqual("taken", Numbers | Where(IsEven) | Take(2) | ToArray(), TArray<int32>({2, 4}));
+		TestEqual("calls", NumCalls, 4);
+	});
+
+	It("take_while", [this]() {
+		const TArray<int32> Numbers = {1, 2, 3, 10, 4, 5};
+		TestEqual("some", Numbers | TakeWhile([](int32 N) { return N < 5; }) | ToArray(), TArray<int32>({1, 2, 3}));
+		TestEqual("all", Numbers | TakeWhile([](int32 N) { return N > 0; }) | ToArray(), Numbers);
+		TestTrue("none", (Numbers | TakeWhile([](int32 N) { return N > 1; }) | ToArray()).IsEmpty());
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -3,6 +3,8 @@
 #include "IGRanges/ToArray.h"
 #include "IGRangesInternal.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/MemStack.h"
+#include <functional>
 #include <ranges>
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -16,6 +18,27 @@ void TestArray(const TArray<int32>& Actual, const TArray<int32>& Expected)
 	TestEqual("contents", Actual, Expected);
 }
 
+// Counts how many times instances are copied.
+struct FCopyCounter
+{
+	FCopyCounter(int32 InValue)
+		: Value(InValue)
+	{
+	}
+
+	FCopyCounter(const FCopyCounter& Other)
+		: Value(Other.Value)
+	{
+		++NumCopies;
+	}
+
+	FCopyCounter(FCopyCounter&& Other) = default;
+
+	int32 Value = 0;
+
+	static inline int32 NumCopies = 0;
+};
+
 END_DEFINE_SPEC(FIGRangesToArraySpec)
 
 void FIGRangesToArraySpec::Define()
@@ -85,6 +108,143 @@ void FIGRangesToArraySpec::Define()
 		const TArray<int32> TestMe = SomeValues | std::views::filter(IsEven) | ToArray();
 		TestArray(TestMe, ExpectedArray);
 	});
+
+	// `ToArray` with `ReserveExact` counts the elements of an unsized range first & reserves exactly that many.
+	It("many_filtered_reserve_exact", [this]() {
+		const auto IsEven = [](auto&& x) {
+			return x % 2 == 0;
+		};
+
+		TArray<int32> ExpectedArray;
+		ExpectedArray.Reserve(NumSomeValues / 2);
+		for (auto&& X : SomeValues)
+		{
+			if (IsEven(X))
+			{
+				ExpectedArray.Emplace(X);
+			}
+		}
+
+		const TArray<int32> TestMe = SomeValues | std::views::filter(IsEven) | ToArray(ReserveExact);
+		TestArray(TestMe, ExpectedArray);
+	});
+
+	// `ToArray` with `ReserveUpperBound` reserves space for every element of the unfiltered range.
+	It("many_filtered_reserve_upper_bound", [this]() {
+		const auto IsEven = [](auto&& x) {
+			return x % 2 == 0;
+		};
+
+		TArray<int32> ExpectedArray;
+		ExpectedArray.Reserve(NumSomeValues);
+		for (auto&& X : SomeValues)
+		{
+			if (IsEven(X))
+			{
+				ExpectedArray.Emplace(X);
+			}
+		}
+
+		const TArray<int32> TestMe = SomeValues | std::views::filter(IsEven) | std::views::transform(std::identity()) | ToArray(ReserveUpperBound);
+		TestArray(TestMe, ExpectedArray);
+	});
+
+	// `ToArray` with `ReservePredicted` learns the selectivity of a filter.
+	It("many_filtered_reserve_predicted", [this]() {
+		const auto IsEven = [](auto&& x) {
+			return x % 2 == 0;
+		};
+
+		FSelectivityEstimate Estimate;
+		TestTrue("initial estimate", Estimate.Get() < 0.0f);
+
+		for (int32 i = 0; i < 3; ++i)
+		{
+			const TArray<int32> TestMe = SomeValues | std::views::filter(IsEven) | ToArray(ReservePredicted(Estimate));
+			TestEqual("count", TestMe.Num(), NumSomeValues / 2);
+			TestEqual("estimate", Estimate.Get(), 0.5f);
+		}
+	});
+
+	// `ToArray` with an inline allocator keeps small results in the array's inline storage.
+	It("inline_allocator", [this]() {
+		TArray<int32> ExpectedArray;
+		ExpectedArray.Append(SomeValues);
+
+		const TArray<int32, TInlineAllocator<16>> TestMe = SomeValues | ToArray<TInlineAllocator<16>>();
+		TestEqual("contents", TArray<int32>(TestMe), ExpectedArray);
+		TestEqual("capacity", TestMe.Max(), 16);
+
+		const TArray<int32, TInlineAllocator<16>> TestMeTransformed = SomeValues | ToArray<TInlineAllocator<16>>([](int32 X) { return X; });
+		TestEqual("contents (transformed)", TArray<int32>(TestMeTransformed), ExpectedArray);
+	});
+
+	// `ToArray` with a mem-stack allocator allocates from the current `FMemStack`.
+	It("mem_stack_allocator", [this]() {
+		TArray<int32> ExpectedArray;
+		ExpectedArray.Append(SomeValues);
+
+		FMemMark Mark(FMemStack::Get());
+		const TArray<int32, TMemStackAllocator<>> TestMe = SomeValues | ToArray<TMemStackAllocator<>>();
+		TestEqual("contents", TArray<int32>(TestMe), ExpectedArray);
+	});
+
+	// `ToArray` moves elements that the range yields by value instead of copying them.
+	It("moves_elements", [this]() {
+		FCopyCounter::NumCopies = 0;
+		const TArray<FCopyCounter> TestMe = SomeValues | ToArray([](int32 X) { return FCopyCounter(X); });
+		TestEqual("count", TestMe.Num(), NumSomeValues);
+		TestEqual("copies", FCopyCounter::NumCopies, 0);
+
+		// Elements of a source container must still be copied.
+		FCopyCounter::NumCopies = 0;
+		const TArray<FCopyCounter> TestMeCopied = TestMe | ToArray();
+		TestEqual("count (copied)", TestMeCopied.Num(), NumSomeValues);
+		TestEqual("copies (copied)", FCopyCounter::NumCopies, NumSomeValues);
+	});
+
+	// `ToArrayInto` replaces the contents of an existing array but keeps its allocation.
+	It("to_array_into", [this]() {
+		const auto IsEven = [](auto&& x) {
+			return x % 2 == 0;
+		};
+
+		TArray<int32> ExpectedArray;
+		for (auto&& X : SomeValues)
+		{
+			if (IsEven(X))
+			{
+				ExpectedArray.Emplace(X);
+			}
+		}
+
+		TArray<int32> TestMe;
+		TestMe.Reserve(32);
+		TestMe.Add(-1);
+		const int32* const Data = TestMe.GetData();
+
+		TArray<int32>& Result = SomeValues | std::views::filter(IsEven) | ToArrayInto(TestMe);
+		TestTrue("result", &Result == &TestMe);
+		TestEqual("contents", TestMe, ExpectedArray);
+		TestEqual("capacity", TestMe.Max(), 32);
+		TestTrue("data", TestMe.GetData() == Data);
+
+		// Refilling with fewer elements doesn't shrink the allocation.
+		const TArray<int32>& Refilled = std::views::single(7) | ToArrayInto(TestMe);
+		TestEqual("contents (refilled)", Refilled, TArray<int32>{7});
+		TestEqual("capacity (refilled)", TestMe.Max(), 32);
+		TestTrue("data (refilled)", TestMe.GetData() == Data);
+	});
+
+	// `ToArrayInto` grows an array that is too small according to the reservation policy.
+	It("to_array_into_reserve", [this]() {
+		TArray<int32> ExpectedArray;
+		ExpectedArray.Append(SomeValues);
+
+		TArray<int32> TestMe;
+		const TArray<int32>& Result = SomeValues | std::views::filter([](int32) { return true; }) | ToArrayInto(TestMe, ReserveUpperBound);
+		TestArray(Result, ExpectedArray);
+	});
 }
 
 #endif // WITH_DEV_AUTOMATION_TESTS
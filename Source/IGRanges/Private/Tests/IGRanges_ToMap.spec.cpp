@@ -0,0 +1,62 @@
+﻿// Copyright Ian Good
+
+#include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/ToMap.h"
+#include "IGRanges/Where.h"
+#include "IGRangesInternal.h"
+#include "Misc/AutomationTest.h"
+#include <ranges>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+DEFINE_SPEC(FIGRangesToMapSpec, "IG.Ranges.ToMap", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
+
+void FIGRangesToMapSpec::Define()
+{
+	using namespace IG::Ranges;
+
+	struct FItem
+	{
+		int32 Id = 0;
+		FString Name;
+	};
+
+	// `ToMap` with an empty range produces an empty map.
+	It("empty", [this]() {
+		const TMap<int32, int32> TestMe = std::ranges::empty_view<int32>() | ToMap([](int32 X) { return X; }, [](int32 X) { return X * 2; });
+		TestEqual("count", TestMe.Num(), 0);
+	});
+
+	// `ToMap` produces a map equal to traditional `TMap` usage.
+	It("many", [this]() {
+		const TArray<FItem> Items = {{1, TEXT("One")}, {2, TEXT("Two")}, {3, TEXT("Three")}};
+
+		const TMap<int32, FString> TestMe = Items | ToMap(&FItem::Id, &FItem::Name);
+		TestEqual("count", TestMe.Num(), 3);
+		TestEqual("one", TestMe[1], FString(TEXT("One")));
+		TestEqual("two", TestMe[2], FString(TEXT("Two")));
+		TestEqual("three", TestMe[3], FString(TEXT("Three")));
+	});
+
+	// The last value is kept for duplicate keys.
+	It("duplicate_keys", [this]() {
+		const TArray<FItem> Items = {{1, TEXT("A")}, {2, TEXT("B")}, {1, TEXT("C")}};
+
+		const TMap<int32, FString> TestMe = Items
+										  | Where([](const FItem& Item) { return Item.Id > 0; })
+										  | ToMap(&FItem::Id, &FItem::Name);
+		TestEqual("count", TestMe.Num(), 2);
+		TestEqual("last value", TestMe[1], FString(TEXT("C")));
+	});
+
+	// Without a value selector, the values are the elements.
+	It("key_only", [this]() {
+		const TArray<int32> Numbers = {5, 10, 15};
+
+		const TMap<int32, int32> TestMe = Numbers | ToMap([](int32 X) { return X / 5; });
+		TestEqual("count", TestMe.Num(), 3);
+		TestEqual("value", TestMe[2], 10);
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -63,6 +63,28 @@ void FIGRangesToSetSpec::Define()
 		TestMe = SomeValues | ToSet(Square);
 		TestSet(TestMe, ExpectedSet);
 	});
+
+	// `ToSet` with a reservation policy produces the same set.
+	It("many_filtered_reserve", [this]() {
+		const auto IsEven = [](auto&& x) {
+			return x % 2 == 0;
+		};
+
+		TSet<int32> ExpectedSet;
+		for (auto&& X : SomeValues)
+		{
+			if (IsEven(X))
+			{
+				ExpectedSet.Emplace(X);
+			}
+		}
+
+		TSet<int32> TestMe = SomeValues | std::views::filter(IsEven) | ToSet(ReserveExact);
+		TestSet(TestMe, ExpectedSet);
+
+		TestMe = SomeValues | std::views::filter(IsEven) | ToSet(ReserveUpperBound);
+		TestSet(TestMe, ExpectedSet);
+	});
 }
 
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -4,17 +4,35 @@
 
 #include "IGRanges/Accumulate.h"
 #include "IGRanges/AllAnyNone.h"
+#include "IGRanges/AppendTo.h"
+#include "IGRanges/AsParallel.h"
 #include "IGRanges/Cast.h"
+#include "IGRanges/Chunk.h"
 #include "IGRanges/Count.h"
 #include "IGRanges/CustomizationPoints.h"
+#include "IGRanges/Distinct.h"
+#include "IGRanges/FilterMap.h"
 #include "IGRanges/Filters/IsChildOf.h"
 #include "IGRanges/FirstOrDefault.h"
+#include "IGRanges/GroupBy.h"
+#include "IGRanges/IndexOf.h"
+#include "IGRanges/LoadAll.h"
+#include "IGRanges/Memoize.h"
 #include "IGRanges/NonNull.h"
 #include "IGRanges/OfType.h"
+#include "IGRanges/OrderBy.h"
+#include "IGRanges/ParallelReduce.h"
+#include "IGRanges/ParallelSearch.h"
+#include "IGRanges/ParallelToArray.h"
+#include "IGRanges/Reserve.h"
+#include "IGRanges/ResolveWeak.h"
 #include "IGRanges/Select.h"
 #include "IGRanges/Selectors/CDO.h"
+#include "IGRanges/Skip.h"
 #include "IGRanges/Sum.h"
+#include "IGRanges/Take.h"
 #include "IGRanges/ToArray.h"
+#include "IGRanges/ToMap.h"
 #include "IGRanges/ToSet.h"
 #include "IGRanges/Where.h"
 
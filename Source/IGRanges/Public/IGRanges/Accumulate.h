@@ -2,8 +2,9 @@
 
 #pragma once
 
-#include <numeric>
 #include <ranges>
+#include <type_traits>
+#include <utility>
 
 #include "IGRanges/Impl/Prologue.inl"
 
@@ -14,9 +15,19 @@ namespace Private
 struct Accumulate_fn
 {
 	template <typename RangeType, typename SeedType, typename FoldType>
+		requires std::ranges::input_range<RangeType>
 	[[nodiscard]] auto operator()(RangeType&& Range, SeedType&& Seed, FoldType&& Fold) const
 	{
-		return std::accumulate(std::begin(Range), std::end(Range), std::forward<SeedType>(Seed), std::forward<FoldType>(Fold));
+		// Same as `std::accumulate`, but the end may be a sentinel (e.g. `TSet`) & the range may be a move-only view.
+		std::decay_t<SeedType> Acc = std::forward<SeedType>(Seed);
+		auto It = std::ranges::begin(Range);
+		const auto End = std::ranges::end(Range);
+		for (; It != End; ++It)
+		{
+			Acc = Fold(std::move(Acc), *It);
+		}
+
+		return Acc;
 	}
 };
 
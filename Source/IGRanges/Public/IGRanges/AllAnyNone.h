@@ -23,19 +23,20 @@ template <EAlgoChoice _Choice>
 struct Algo_fn
 {
 	template <typename RangeType, class _Pr>
+		requires std::ranges::input_range<RangeType>
 	[[nodiscard]] constexpr bool operator()(RangeType&& Range, _Pr _Pred) const
 	{
 		if constexpr (_Choice == EAlgoChoice::AllOf)
 		{
-			return std::all_of(std::begin(Range), std::end(Range), std::move(_Pred));
+			return std::ranges::all_of(Range, std::move(_Pred));
 		}
 		else if constexpr (_Choice == EAlgoChoice::AnyOf)
 		{
-			return std::any_of(std::begin(Range), std::end(Range), std::move(_Pred));
+			return std::ranges::any_of(Range, std::move(_Pred));
 		}
 		else if constexpr (_Choice == EAlgoChoice::NoneOf)
 		{
-			return std::none_of(std::begin(Range), std::end(Range), std::move(_Pred));
+			return std::ranges::none_of(Range, std::move(_Pred));
 		}
 	}
 };
@@ -0,0 +1,60 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "IGRanges/Reserve.h"
+#include <ranges>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+struct AppendTo_fn
+{
+	template <typename RangeType, typename ContainerType, typename PolicyType>
+	ContainerType& operator()(RangeType&& Range, ContainerType* Container, const PolicyType& Policy) const
+	{
+		using SizeType = decltype(Container->Num());
+
+		const SizeType NumBefore = Container->Num();
+
+		if (const int64 ReserveCount = Policy.GetReserveCount(Range); ReserveCount > 0)
+		{
+			Container->Reserve(NumBefore + static_cast<SizeType>(ReserveCount));
+		}
+
+		for (auto&& X : Range)
+		{
+			// Elements that the range yields by value (e.g. from `Select`) are moved rather than copied.
+			Container->Emplace(std::forward<decltype(X)>(X));
+		}
+
+		Policy.Observe(Range, Container->Num() - NumBefore);
+		return *Container;
+	}
+};
+
+} // namespace Private
+
+/**
+ * Adds the elements of a range to an existing container (e.g. `TArray` or `TSet`).
+ * The container's existing elements & capacity are kept, so a scratch container can be reused between queries without
+ * reallocating once it has grown large enough.
+ * A reservation policy (`ReserveExact`, `ReserveUpperBound`, or `ReservePredicted`) may be specified.
+ *
+ * @usage
+ * TArray<APawn*>& AllPawns = MorePawns | AppendTo(KnownPawns);
+ * const TSet<AActor*>& Owners = SomeComponents | Select(&UActorComponent::GetOwner) | AppendTo(UniqueOwners, ReserveUpperBound);
+ */
+template <typename ContainerType, typename PolicyType = _IGRP FReserveIfSized>
+	requires _IGRP ReservePolicy<PolicyType>
+[[nodiscard]] constexpr auto AppendTo(ContainerType& Container, PolicyType Policy = {})
+{
+	return std::ranges::_Range_closure<_IGRP AppendTo_fn, ContainerType*, PolicyType>{&Container, std::move(Policy)};
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
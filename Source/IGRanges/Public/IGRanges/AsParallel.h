@@ -0,0 +1,447 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "HAL/CriticalSection.h"
+#include "IGRanges/AllAnyNone.h"
+#include "IGRanges/Count.h"
+#include "IGRanges/FirstOrDefault.h"
+#include "IGRanges/Impl/Common.h"
+#include "IGRanges/Impl/FilterMapView.h"
+#include "IGRanges/Impl/Parallel.h"
+#include "IGRanges/ParallelToArray.h"
+#include "IGRanges/Sum.h"
+#include "IGRanges/ToArray.h"
+#include "Misc/Optional.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/SharedPointer.h"
+#include <atomic>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+template <bool bOrdered>
+struct TParallelQueryOrdering
+{
+};
+
+struct FParallelQueryDegree
+{
+	int32 DegreeOfParallelism = 0;
+};
+
+/**
+ * Whether `ViewType` wraps `BaseType` in one or more views that act on one element at a time, i.e. views that yield the
+ * same elements whether the base is split into chunks first or not. These are the views produced by `Where`,
+ * `SafeWhere`, `Select`, `OfType`, `NonNull`, & `Cast`.
+ */
+template <typename ViewType, typename BaseType>
+inline constexpr bool TIsElementwiseView_V = false;
+
+template <typename ViewType, typename PredicateType, typename BaseType>
+inline constexpr bool TIsElementwiseView_V<std::ranges::filter_view<ViewType, PredicateType>, BaseType> =
+	std::is_same_v<ViewType, BaseType> || TIsElementwiseView_V<ViewType, BaseType>;
+
+template <typename ViewType, typename FuncType, typename BaseType>
+inline constexpr bool TIsElementwiseView_V<std::ranges::transform_view<ViewType, FuncType>, BaseType> =
+	std::is_same_v<ViewType, BaseType> || TIsElementwiseView_V<ViewType, BaseType>;
+
+template <typename ViewType, typename FuncType, typename BaseType>
+inline constexpr bool TIsElementwiseView_V<TFilterMapView<ViewType, FuncType>, BaseType> =
+	std::is_same_v<ViewType, BaseType> || TIsElementwiseView_V<ViewType, BaseType>;
+
+/**
+ * Adaptors that may follow `AsParallel` in a query of type `QueryType`.
+ * Adaptors that depend on the elements around each element (e.g. `Take`, `Skip`, `Distinct`, `OrderBy`, `Chunk`) aren't
+ * allowed since they would only be applied within each chunk.
+ */
+template <typename QueryType, typename AdaptorType>
+concept ParallelQueryAdaptor = TIsElementwiseView_V<
+	std::remove_cvref_t<decltype(std::declval<typename QueryType::ChunkViewType>() | std::declval<AdaptorType>())>,
+	typename QueryType::ChunkViewType>;
+
+/**
+ * Describes how a terminal runs at the end of a parallel query (see `AsParallel`).
+ * Supported terminals specialize this with `bSupported = true` & a static `Run(Query, Terminal)`.
+ */
+template <typename FnType>
+struct TParallelQueryTerminal
+{
+	static constexpr bool bSupported = false;
+};
+
+/**
+ * The result of `AsParallel`: a sized random-access source, the adaptors that have been applied to it since, & how it
+ * should be executed. It isn't a range itself.
+ *
+ * Element-wise adaptors (e.g. `Where`, `Select`) are composed into a pipeline that's applied separately to each chunk of
+ * the source. A terminal (e.g. `ToArray`, `Count`) then runs the pipeline over all of the chunks on the task graph &
+ * combines their results.
+ */
+template <typename ViewType, typename PipelineType, bool bOrdered>
+class TParallelQuery
+{
+public:
+	using ChunkType = std::ranges::subrange<std::ranges::iterator_t<const ViewType>>;
+	using ChunkViewType = decltype(std::declval<ChunkType>() | std::declval<const PipelineType&>());
+
+	static constexpr bool bIsOrdered = bOrdered;
+
+	// Pipelines often filter out more elements in some chunks than in others, so each task claims several smaller chunks.
+	static constexpr int32 ChunksPerTask = 4;
+
+	TParallelQuery(ViewType InSource, PipelineType InPipeline, const FParallelOptions& InOptions)
+		: Source(std::move(InSource))
+		, Pipeline(std::move(InPipeline))
+		, Options(InOptions)
+	{
+	}
+
+	[[nodiscard]] FClaimableChunks MakeChunks() const
+	{
+		return FClaimableChunks(std::ranges::ssize(Source), Options, ChunksPerTask);
+	}
+
+	/**
+	 * Invokes `Body(ChunkIndex, View)` for every chunk, potentially in parallel, where `View` is the chunk with the
+	 * pipeline applied to it.
+	 */
+	template <typename BodyType>
+	void ForEachChunk(const FClaimableChunks& Chunks, const BodyType& Body) const
+	{
+		const auto First = std::ranges::begin(Source);
+		_IGRP ParallelForEachClaimedChunk(Chunks, [&](int32 ChunkIndex, int64 Begin, int64 End) {
+			Body(ChunkIndex, ChunkType(_IGRP Advanced(First, Begin), _IGRP Advanced(First, End)) | Pipeline);
+		});
+	}
+
+	/** Adds an adaptor (e.g. `Where`, `Select`, `OfType`) to the pipeline. */
+	template <typename AdaptorType>
+		requires std::ranges::view<decltype(std::declval<ChunkViewType>() | std::declval<AdaptorType>())>
+	[[nodiscard]] friend auto operator|(TParallelQuery Query, AdaptorType&& Adaptor)
+	{
+		static_assert(_IGRP ParallelQueryAdaptor<TParallelQuery, AdaptorType>, "This adaptor isn't supported after `AsParallel` because it would only be applied within each chunk. Supported adaptors are `Where`, `SafeWhere`, `Select`, `OfType`, `NonNull`, & `Cast`.");
+
+		auto NewPipeline = std::move(Query.Pipeline) | std::forward<AdaptorType>(Adaptor);
+		return TParallelQuery<ViewType, decltype(NewPipeline), bOrdered>(std::move(Query.Source), std::move(NewPipeline), Query.Options);
+	}
+
+	/** Runs the query with a terminal (e.g. `ToArray`, `Count`). */
+	template <typename FnType, typename... ArgTypes>
+		requires(!std::ranges::view<decltype(std::declval<ChunkViewType>() | std::declval<const std::ranges::_Range_closure<FnType, ArgTypes...>&>())>)
+	[[nodiscard]] friend auto operator|(TParallelQuery Query, const std::ranges::_Range_closure<FnType, ArgTypes...>& Terminal)
+	{
+		static_assert(_IGRP TParallelQueryTerminal<FnType>::bSupported, "This terminal isn't supported after `AsParallel`. Supported terminals are `ToArray`, `Count`, `Sum`, `All`, `Any`, `None`, & `FirstOrDefault`.");
+
+		return _IGRP TParallelQueryTerminal<FnType>::Run(Query, Terminal);
+	}
+
+	/** Changes whether results must be in the order of the source (see `AsOrdered` & `AsUnordered`). */
+	template <bool bNewOrdered>
+	[[nodiscard]] friend auto operator|(TParallelQuery Query, TParallelQueryOrdering<bNewOrdered>)
+	{
+		return TParallelQuery<ViewType, PipelineType, bNewOrdered>(std::move(Query.Source), std::move(Query.Pipeline), Query.Options);
+	}
+
+	/** Changes the most tasks that run the query at once (see `WithDegreeOfParallelism`). */
+	[[nodiscard]] friend TParallelQuery operator|(TParallelQuery Query, FParallelQueryDegree Degree)
+	{
+		Query.Options.MaxTasks = Degree.DegreeOfParallelism;
+		return Query;
+	}
+
+private:
+	ViewType Source;
+	PipelineType Pipeline;
+	FParallelOptions Options;
+};
+
+struct AsParallel_fn
+{
+	template <std::ranges::viewable_range RangeType>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range, const FParallelOptions& Options) const
+	{
+		static_assert(_IGRP ParallelizableRange<RangeType>, "`AsParallel` requires a sized random-access range.");
+
+		using ViewType = std::views::all_t<RangeType>;
+		using PipelineType = std::remove_cvref_t<decltype(std::views::all)>;
+		return _IGRP TParallelQuery<ViewType, PipelineType, true>(std::views::all(std::forward<RangeType>(Range)), std::views::all, Options);
+	}
+};
+
+/**
+ * Terminals whose results for each chunk are added together (in the order of the chunks).
+ * Chunks that are empty once the pipeline has been applied are skipped, so `Sum` doesn't add default values.
+ */
+struct FParallelQueryAddTerminal
+{
+	static constexpr bool bSupported = true;
+
+	template <typename QueryType, typename TerminalType>
+	[[nodiscard]] static auto Run(const QueryType& Query, const TerminalType& Terminal)
+	{
+		using ResultType = std::remove_cvref_t<decltype(std::declval<typename QueryType::ChunkViewType&>() | Terminal)>;
+
+		const FClaimableChunks Chunks = Query.MakeChunks();
+
+		TArray<TOptional<ResultType>> Partials;
+		Partials.SetNum(Chunks.GetNumChunks());
+
+		Query.ForEachChunk(Chunks, [&](int32 ChunkIndex, auto View) {
+			// Finds the first element once & passes the rest of the chunk on from there, since filtering views may not
+			// cache `begin` & input-only views can't be read twice.
+			auto First = std::ranges::begin(View);
+			const auto Last = std::ranges::end(View);
+			if (First != Last)
+			{
+				Partials[ChunkIndex].Emplace(std::ranges::subrange(std::move(First), Last) | Terminal);
+			}
+		});
+
+		ResultType Result = _IGRP Construct<ResultType>();
+		bool bHasResult = false;
+		for (TOptional<ResultType>& Partial : Partials)
+		{
+			if (Partial.IsSet())
+			{
+				Result = bHasResult ? (std::move(Result) + std::move(*Partial)) : std::move(*Partial);
+				bHasResult = true;
+			}
+		}
+
+		return Result;
+	}
+};
+
+template <>
+struct TParallelQueryTerminal<Count_fn> : FParallelQueryAddTerminal
+{
+};
+
+template <>
+struct TParallelQueryTerminal<CountIf_fn> : FParallelQueryAddTerminal
+{
+};
+
+template <>
+struct TParallelQueryTerminal<Sum_fn> : FParallelQueryAddTerminal
+{
+};
+
+template <>
+struct TParallelQueryTerminal<SumBy_fn> : FParallelQueryAddTerminal
+{
+};
+
+template <EAlgoChoice _Choice>
+struct TParallelQueryTerminal<Algo_fn<_Choice>>
+{
+	static constexpr bool bSupported = true;
+
+	template <typename QueryType, typename TerminalType>
+	[[nodiscard]] static bool Run(const QueryType& Query, const TerminalType& Terminal)
+	{
+		// The result for a chunk that decides the answer for the whole query: an element that fails `All` or `None`
+		// makes them false & an element that passes `Any` makes it true.
+		constexpr bool bDecisive = (_Choice == EAlgoChoice::AnyOf);
+
+		std::atomic<bool> bDecided = false;
+		const auto IsUndecided = [&bDecided](auto&&) {
+			return !bDecided.load(std::memory_order_relaxed);
+		};
+
+		const FClaimableChunks Chunks = Query.MakeChunks();
+		Query.ForEachChunk(Chunks, [&](int32, auto View) {
+			// Stops reading elements part way through a chunk once another chunk has decided the answer. The result for
+			// this chunk may then be wrong, but it's no longer needed.
+			if (!bDecided.load(std::memory_order_relaxed) && (std::move(View) | std::views::take_while(IsUndecided) | Terminal) == bDecisive)
+			{
+				bDecided.store(true, std::memory_order_relaxed);
+			}
+		});
+
+		return bDecided.load(std::memory_order_relaxed) ? bDecisive : !bDecisive;
+	}
+};
+
+template <>
+struct TParallelQueryTerminal<FirstOrDefault_fn>
+{
+	static constexpr bool bSupported = true;
+
+	template <typename QueryType, typename TerminalType>
+	[[nodiscard]] static auto Run(const QueryType& Query, const TerminalType&)
+	{
+		static_assert(std::is_same_v<TerminalType, std::ranges::_Range_closure<FirstOrDefault_fn, _IGRP AlwaysTrue>>, "`FirstOrDefault` doesn't support a predicate after `AsParallel`. Use `Where(Pred) | FirstOrDefault()` instead.");
+
+		using T = std::ranges::range_value_t<typename QueryType::ChunkViewType>;
+
+		static_assert(!TIsTSharedRef_V<T>, "`FirstOrDefault` cannot operate on ranges of `TSharedRef`.");
+
+		constexpr int32 NotFound = std::numeric_limits<int32>::max();
+		std::atomic<int32> FoundChunk = NotFound;
+
+		// Ordered queries need the first element of the first chunk that has one, so only the chunks after it can stop.
+		// Unordered queries return the first element that's found, so every chunk stops.
+		const auto IsDecided = [&FoundChunk](int32 ChunkIndex) {
+			const int32 Found = FoundChunk.load(std::memory_order_relaxed);
+			return QueryType::bIsOrdered ? (Found < ChunkIndex) : (Found != NotFound);
+		};
+
+		const FClaimableChunks Chunks = Query.MakeChunks();
+
+		TArray<TOptional<T>> Partials;
+		Partials.SetNum(Chunks.GetNumChunks());
+
+		Query.ForEachChunk(Chunks, [&](int32 ChunkIndex, auto View) {
+			if (IsDecided(ChunkIndex))
+			{
+				return;
+			}
+
+			auto Remaining = std::move(View) | std::views::take_while([&IsDecided, ChunkIndex](auto&&) {
+				return !IsDecided(ChunkIndex);
+			});
+
+			const auto It = std::ranges::begin(Remaining);
+			if (It == std::ranges::end(Remaining))
+			{
+				return;
+			}
+
+			Partials[ChunkIndex].Emplace(*It);
+
+			// Keep the lowest chunk if another chunk published an element at the same time.
+			int32 Expected = FoundChunk.load(std::memory_order_relaxed);
+			while (ChunkIndex < Expected && !FoundChunk.compare_exchange_weak(Expected, ChunkIndex, std::memory_order_relaxed))
+			{
+			}
+		});
+
+		const int32 Found = FoundChunk.load(std::memory_order_relaxed);
+		if (Found == NotFound)
+		{
+			return _IGRP Construct<T>();
+		}
+
+		return T(std::move(*Partials[Found]));
+	}
+};
+
+template <typename AllocatorType>
+struct TParallelQueryTerminal<ToArray_fn<AllocatorType>>
+{
+	static constexpr bool bSupported = true;
+
+	template <typename QueryType, typename TerminalType>
+	[[nodiscard]] static auto Run(const QueryType& Query, const TerminalType& Terminal)
+	{
+		using ArrayType = decltype(std::declval<typename QueryType::ChunkViewType>() | Terminal);
+
+		const FClaimableChunks Chunks = Query.MakeChunks();
+
+		if constexpr (QueryType::bIsOrdered)
+		{
+			// Each chunk is collected into its own buffer & the buffers are concatenated in source order at the end.
+			TArray<ArrayType> Buffers;
+			Buffers.SetNum(Chunks.GetNumChunks());
+
+			Query.ForEachChunk(Chunks, [&](int32 ChunkIndex, auto View) {
+				ArrayType Buffer = std::move(View) | Terminal;
+				Buffers[ChunkIndex] = MoveTemp(Buffer);
+			});
+
+			return _IGRP ConcatenateInParallel(Buffers);
+		}
+		else
+		{
+			// Each chunk is appended to the result as soon as it's collected, in whichever order the chunks finish.
+			ArrayType Result;
+			FCriticalSection ResultLock;
+
+			Query.ForEachChunk(Chunks, [&](int32, auto View) {
+				ArrayType Buffer = std::move(View) | Terminal;
+
+				FScopeLock Lock(&ResultLock);
+				Result.Append(MoveTemp(Buffer));
+			});
+
+			return Result;
+		}
+	}
+};
+
+} // namespace Private
+
+/**
+ * Runs the rest of a query in parallel on the task graph, similar to PLINQ's `AsParallel`.
+ * Must be applied to a sized random-access range (e.g. `TArray`, `TArrayView`, or `Select` applied to one of those).
+ *
+ * The adaptors that follow it are applied to separate chunks of the range by each task, so an existing query can be
+ * parallelized by adding this one stage after its source. Only adaptors that act on one element at a time are allowed:
+ * `Where`, `SafeWhere`, `Select`, `OfType`, `NonNull`, & `Cast` (& their variants, e.g. `OfTypeRef`), since adaptors like
+ * `Take`, `Distinct`, or `OrderBy` would only be applied within each chunk. The query must end with one of these
+ * terminals: `ToArray`, `Count`, `Sum`, `All`, `Any`, `None`, or `FirstOrDefault` (without a predicate).
+ * The range is split into several chunks per task & tasks claim the next chunk whenever they finish one, so the work
+ * stays balanced even when filters remove many more elements from some parts of the range than from others.
+ *
+ * Results are in the same order as the serial query unless `AsUnordered` is applied.
+ * The pipeline is invoked concurrently from multiple threads, so it must not modify shared state.
+ *
+ * @usage
+ * TArray<FVector> Locations = SomeActors | AsParallel() | OfType<APawn>() | Where(&APawn::IsPlayerControlled) | Select(&APawn::GetActorLocation) | ToArray();
+ * int32 NumVisible = SomeActors | AsParallel() | Where([&](const AActor* A) { return HasLineOfSight(Viewer, A); }) | Count();
+ */
+[[nodiscard]] inline constexpr auto AsParallel(const FParallelOptions& Options = {})
+{
+	return std::ranges::_Range_closure<_IGRP AsParallel_fn, FParallelOptions>{FParallelOptions(Options)};
+}
+
+/**
+ * Makes the results of a parallel query (see `AsParallel`) be in the same order as the source.
+ * This is the default.
+ *
+ * @usage
+ * SomeActors | AsParallel() | AsOrdered() | Where(&AActor::CanBeDamaged) | FirstOrDefault()
+ */
+[[nodiscard]] inline constexpr auto AsOrdered()
+{
+	return _IGRP TParallelQueryOrdering<true>();
+}
+
+/**
+ * Allows the results of a parallel query (see `AsParallel`) to be in any order.
+ * `ToArray` appends each chunk's elements as soon as they're ready, instead of concatenating them in order at the end,
+ * & `FirstOrDefault` returns whichever element is found first.
+ *
+ * @usage
+ * TArray<AActor*> Targets = SomeActors | AsParallel() | AsUnordered() | Where(&AActor::CanBeDamaged) | ToArray();
+ */
+[[nodiscard]] inline constexpr auto AsUnordered()
+{
+	return _IGRP TParallelQueryOrdering<false>();
+}
+
+/**
+ * Limits how many tasks run a parallel query (see `AsParallel`) at once.
+ * Zero means one task per task graph worker thread, plus one for the calling thread (see `FParallelOptions::MaxTasks`).
+ *
+ * @usage
+ * SomeActors | AsParallel() | WithDegreeOfParallelism(4) | Where(&AActor::CanBeDamaged) | Count()
+ */
+[[nodiscard]] inline constexpr auto WithDegreeOfParallelism(int32 DegreeOfParallelism)
+{
+	return _IGRP FParallelQueryDegree{DegreeOfParallelism};
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
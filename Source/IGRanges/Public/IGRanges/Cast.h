@@ -2,21 +2,144 @@
 
 #pragma once
 
+#include "HAL/Platform.h" // `UPTRINT`
 #include "Templates/Casts.h"
+#include "UObject/Class.h"
+#include <atomic>
+#include <concepts>
 #include <ranges>
+#include <type_traits>
+
+#include "IGRanges/Impl/Prologue.inl"
 
 namespace IG::Ranges
 {
+namespace Private
+{
+/**
+ * Tests whether objects are children of a class, remembering the class of the last object tested & the result.
+ * Arrays of actors or components tend to have long runs of objects of the same class, so most elements skip the
+ * `IsChildOf` check entirely.
+ *
+ * Each view (i.e. each copy of the filter) remembers its own class, so nothing outlives the view & the parallel
+ * terminals, which apply their pipeline to each chunk separately, never share a cache between tasks. The class & result
+ * are packed into one word (classes are aligned, so the low bit is free) so that a view that is iterated by
+ * several threads at once always reads a consistent pair.
+ */
+class FClassMatchCache
+{
+public:
+	explicit constexpr FClassMatchCache(const UClass* InClass)
+		: Class(InClass)
+	{
+	}
+
+	FClassMatchCache(const FClassMatchCache& Other)
+		: Class(Other.Class)
+		, LastClassAndMatch(Other.LastClassAndMatch.load(std::memory_order_relaxed))
+	{
+	}
+
+	FClassMatchCache& operator=(const FClassMatchCache& Other)
+	{
+		Class = Other.Class;
+		LastClassAndMatch.store(Other.LastClassAndMatch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		return *this;
+	}
+
+	[[nodiscard]] bool IsA(const UObject* Obj) const
+	{
+		if (Obj == nullptr)
+		{
+			return false;
+		}
+
+		const UClass* ObjClass = Obj->GetClass();
+		const UPTRINT ClassBits = reinterpret_cast<UPTRINT>(ObjClass);
+
+		const UPTRINT Last = LastClassAndMatch.load(std::memory_order_relaxed);
+		if ((Last & ~UPTRINT(1)) == ClassBits)
+		{
+			return (Last & 1) != 0;
+		}
+
+		const bool bMatch = ObjClass->IsChildOf(Class);
+		LastClassAndMatch.store(ClassBits | UPTRINT(bMatch), std::memory_order_relaxed);
+		return bMatch;
+	}
+
+private:
+	const UClass* Class = nullptr;
+	mutable std::atomic<UPTRINT> LastClassAndMatch = 0;
+};
+
+/**
+ * Raw pointers to UObjects that might be a `T` (i.e. down-casts & cross-casts, not up-casts) are cast with a
+ * `FClassMatchCache` instead of `::Cast<T>`.
+ */
+template <typename PointerType, class T>
+concept CachedCastable =
+	std::is_pointer_v<PointerType>
+	&& std::derived_from<std::remove_cv_t<std::remove_pointer_t<PointerType>>, UObject>
+	&& std::derived_from<std::remove_cv_t<T>, UObject>
+	&& !std::derived_from<std::remove_cv_t<std::remove_pointer_t<PointerType>>, std::remove_cv_t<T>>;
+
+template <class T>
+struct TCachedCast
+{
+	FClassMatchCache Cache{std::remove_cv_t<T>::StaticClass()};
+
+	template <typename ObjectType>
+	[[nodiscard]] auto operator()(ObjectType* Obj) const
+	{
+		using ResultType = decltype(::Cast<T>(Obj));
+		using UObjectType = std::conditional_t<std::is_const_v<ObjectType>, const UObject, UObject>;
+		return Cache.IsA(Obj) ? static_cast<ResultType>(static_cast<UObjectType*>(Obj)) : nullptr;
+	}
+};
+
+/**
+ * Gets the function object that `Cast<T>` applies to elements of a range of `PointerType`.
+ */
+template <class T, typename PointerType>
+[[nodiscard]] auto MakeCaster()
+{
+	if constexpr (_IGRP CachedCastable<PointerType, T>)
+	{
+		return _IGRP TCachedCast<T>();
+	}
+	else
+	{
+		return [](auto&& x) { return ::Cast<T>(x); };
+	}
+}
+
+template <class T>
+struct Cast_fn
+{
+	template <std::ranges::viewable_range RangeType>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range) const
+	{
+		using PointerType = std::remove_cvref_t<std::ranges::range_reference_t<RangeType>>;
+		return std::views::transform(std::forward<RangeType>(Range), _IGRP MakeCaster<T, PointerType>());
+	}
+};
+
+} // namespace Private
+
 /**
  * Casts the values of a range of UObjects to a specified type using UE's `Cast<T>` function.
  * Safe to accept null values; may yield null results.
  *
+ * For ranges of raw pointers, the class of the previous object & whether it matched are remembered, so runs of objects
+ * with the same class only check the class hierarchy once.
+ *
  * @see `OfType<T>`
  */
 template <class T>
 [[nodiscard]] constexpr auto Cast()
 {
-	return std::views::transform([](auto&& x) { return ::Cast<T>(x); });
+	return std::ranges::_Range_closure<_IGRP Cast_fn<T>>{};
 }
 
 /**
@@ -56,9 +179,11 @@ template <class T>
 template <class T>
 [[nodiscard]] constexpr auto CastChecked(ECastCheckedType::Type CheckType)
 {
-	return std::views::transform([](auto&& x) { return ::CastChecked<T>(x, CheckType); });
+	return std::views::transform([CheckType](auto&& x) { return ::CastChecked<T>(x, CheckType); });
 }
 
 // Note: There is no `CastCheckedRef(ECastCheckedType::Type)` because it allows for null-in / null-out.
 
 } // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
@@ -0,0 +1,204 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "HAL/Platform.h" // `int32`
+#include "Math/UnrealMathUtility.h"
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+/**
+ * View that splits another view into batches of (at most) `ChunkSize` elements that are copied into a buffer, for
+ * ranges whose elements aren't stored contiguously (e.g. `Where`, `Select`).
+ * The buffer is kept in the view & reused for every batch, so it's an input range: each call to `begin` starts over.
+ */
+template <std::ranges::input_range ViewType>
+	requires std::ranges::view<ViewType>
+class TChunkBufferView : public std::ranges::view_interface<TChunkBufferView<ViewType>>
+{
+	using ElementType = std::ranges::range_value_t<ViewType>;
+
+	class FIterator
+	{
+	public:
+		using value_type = TArrayView<ElementType>;
+		using difference_type = std::ptrdiff_t;
+		using iterator_concept = std::input_iterator_tag;
+
+		FIterator() = default;
+
+		explicit FIterator(TChunkBufferView& InParent)
+			: Parent(&InParent)
+			, Current(std::ranges::begin(InParent.Base))
+		{
+			Fill();
+		}
+
+		[[nodiscard]] TArrayView<ElementType> operator*() const
+		{
+			return TArrayView<ElementType>(Parent->Buffer.GetData(), Parent->Buffer.Num());
+		}
+
+		FIterator& operator++()
+		{
+			Fill();
+			return *this;
+		}
+
+		void operator++(int)
+		{
+			++*this;
+		}
+
+		[[nodiscard]] friend bool operator==(const FIterator& Lhs, std::default_sentinel_t)
+		{
+			return Lhs.IsAtEnd();
+		}
+
+	private:
+		[[nodiscard]] bool IsAtEnd() const
+		{
+			return Parent->Buffer.IsEmpty();
+		}
+
+		/** Copies the next batch into the buffer, without advancing past the last element of the batch until the next one. */
+		void Fill()
+		{
+			TArray<ElementType>& Buffer = Parent->Buffer;
+			Buffer.Reset();
+
+			const auto End = std::ranges::end(Parent->Base);
+			if (bPendingIncrement)
+			{
+				++Current;
+				bPendingIncrement = false;
+			}
+
+			while (Current != End)
+			{
+				Buffer.Emplace(*Current);
+				if (Buffer.Num() == Parent->ChunkSize)
+				{
+					bPendingIncrement = true;
+					return;
+				}
+
+				++Current;
+			}
+		}
+
+		TChunkBufferView* Parent = nullptr;
+		std::ranges::iterator_t<ViewType> Current = std::ranges::iterator_t<ViewType>();
+		bool bPendingIncrement = false;
+	};
+
+public:
+	TChunkBufferView()
+		requires std::default_initializable<ViewType>
+	= default;
+
+	TChunkBufferView(ViewType InBase, int32 InChunkSize)
+		: Base(std::move(InBase))
+		, ChunkSize(InChunkSize)
+	{
+	}
+
+	[[nodiscard]] ViewType base() const&
+		requires std::copy_constructible<ViewType>
+	{
+		return Base;
+	}
+
+	[[nodiscard]] ViewType base() &&
+	{
+		return std::move(Base);
+	}
+
+	[[nodiscard]] FIterator begin()
+	{
+		Buffer.Reset(ChunkSize);
+		return FIterator(*this);
+	}
+
+	[[nodiscard]] std::default_sentinel_t end() const
+	{
+		return std::default_sentinel;
+	}
+
+	[[nodiscard]] auto size() const
+		requires std::ranges::sized_range<const ViewType>
+	{
+		const auto Num = std::ranges::size(Base);
+		return (Num + ChunkSize - 1) / ChunkSize;
+	}
+
+private:
+	ViewType Base;
+	int32 ChunkSize = 1;
+	TArray<ElementType> Buffer;
+};
+
+template <typename RangeType>
+TChunkBufferView(RangeType&&, int32) -> TChunkBufferView<std::views::all_t<RangeType>>;
+
+struct Chunk_fn
+{
+	template <std::ranges::viewable_range RangeType>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range, int32 ChunkSize) const
+	{
+		ChunkSize = FMath::Max(ChunkSize, 1);
+
+		// Contiguous elements that outlive the pipeline are viewed in place. Temporary containers are buffered instead so
+		// that the view owns them.
+		if constexpr (std::ranges::contiguous_range<RangeType> && std::ranges::sized_range<RangeType> && std::ranges::borrowed_range<RangeType>)
+		{
+			using ElementType = std::remove_reference_t<std::ranges::range_reference_t<RangeType>>;
+
+			ElementType* const Data = std::ranges::data(Range);
+			const int32 Num = static_cast<int32>(std::ranges::size(Range));
+			const int32 NumChunks = (Num + ChunkSize - 1) / ChunkSize;
+			return std::views::iota(0, NumChunks) | std::views::transform([Data, Num, ChunkSize](int32 ChunkIndex) {
+				const int32 First = ChunkIndex * ChunkSize;
+				return TArrayView<ElementType>(Data + First, FMath::Min(ChunkSize, Num - First));
+			});
+		}
+		else
+		{
+			return _IGRP TChunkBufferView(std::views::all(std::forward<RangeType>(Range)), ChunkSize);
+		}
+	}
+};
+
+} // namespace Private
+
+/**
+ * Splits a sequence into consecutive batches of `ChunkSize` elements (the last batch may be smaller), each of which is
+ * yielded as a `TArrayView`.
+ *
+ * Contiguous sequences (e.g. `TArray`, `TArrayView`) are viewed in place: no elements are copied & the result is a
+ * sized random-access range of `TArrayView<T>` (or `TArrayView<const T>`), which can be handed to `ParallelFor` bodies,
+ * vectorized kernels, etc.
+ * Other sequences (e.g. ones that use `Where` or `Select`) copy each batch into a buffer that's reused for every batch;
+ * the views that are yielded are only valid until the next batch is read.
+ *
+ * @usage
+ * for (TArrayView<const FVector> Batch : SomePoints | Chunk(256)) { ... }
+ * for (TArrayView<float> Batch : SomeActors | Select(&AActor::GetLifeSpan) | Chunk(64)) { ... }
+ */
+[[nodiscard]] inline constexpr auto Chunk(int32 ChunkSize)
+{
+	return std::ranges::_Range_closure<_IGRP Chunk_fn, int32>{ChunkSize};
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "HAL/Platform.h" // `int32`
+#include "IGRanges/Impl/Vectorized.h"
+#include <functional>
 #include <ranges>
 
 #include "IGRanges/Impl/Prologue.inl"
@@ -14,12 +16,30 @@ namespace Private
 struct Count_fn
 {
 	template <typename RangeType>
+		requires std::ranges::input_range<RangeType>
 	[[nodiscard]] constexpr auto operator()(RangeType&& Range) const
 	{
 		return static_cast<int32>(std::ranges::distance(std::forward<RangeType>(Range)));
 	}
 };
 
+struct CountIf_fn
+{
+	template <typename RangeType, typename PredicateType>
+		requires std::ranges::input_range<RangeType> && std::invocable<PredicateType&, std::ranges::range_reference_t<RangeType>>
+	[[nodiscard]] constexpr int32 operator()(RangeType&& Range, PredicateType&& Pred) const
+	{
+		if constexpr (std::ranges::contiguous_range<RangeType> && std::ranges::sized_range<RangeType> && _IGRP BranchlessElement<std::ranges::range_value_t<RangeType>>)
+		{
+			return static_cast<int32>(_IGRP CountContiguous(std::ranges::data(Range), static_cast<int64>(std::ranges::size(Range)), Pred));
+		}
+		else
+		{
+			return static_cast<int32>(std::ranges::distance(std::views::filter(std::forward<RangeType>(Range), std::forward<PredicateType>(Pred))));
+		}
+	}
+};
+
 } // namespace Private
 
 /**
@@ -37,14 +57,17 @@ struct Count_fn
  * Returns the number of elements in a range that satisfy a predicate.
  * Equivalent to `Where(pred) | Count()`.
  *
+ * Contiguous ranges (e.g. `TArray`) of arithmetic, enum, or pointer values are counted without branching on the
+ * predicate, so simple comparisons are vectorized instead of mispredicting on unsorted data.
+ *
  * @usage
  * int32 NumVulerableActors = SomeActors | Count(&AActor::CanBeDamaged);
+ * int32 NumNegative = SomeNumbers | Count([](int32 N) { return N < 0; });
  */
 template <class _Pr>
 [[nodiscard]] constexpr auto Count(_Pr&& _Pred)
 {
-	return std::views::filter(std::forward<_Pr>(_Pred))
-		 | _IGR Count();
+	return std::ranges::_Range_closure<_IGRP CountIf_fn, std::decay_t<_Pr>>{std::forward<_Pr>(_Pred)};
 }
 
 } // namespace IG::Ranges
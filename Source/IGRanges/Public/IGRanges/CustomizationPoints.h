@@ -10,36 +10,47 @@
 
 #include "Containers/Array.h"
 #include "Containers/ArrayView.h"
+#include "Containers/BitArray.h"
+#include "Containers/ChunkedArray.h"
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Containers/SparseArray.h"
+#include "IGRanges/Impl/ContainerIterators.h"
+#include <iterator>
+#include <ranges>
 
 //---------------------------------------------------------------------------------------
 
-template <class T>
-auto begin(TArray<T>& r)
+// Templated on the allocator so that arrays using `TInlineAllocator`, `TFixedAllocator`, `TMemStackAllocator`, etc.
+// (including `TArray64`) are contiguous ranges too.
+
+template <class T, class AllocatorType>
+auto begin(TArray<T, AllocatorType>& r)
 {
 	return r.GetData();
 }
 
-template <class T>
-auto end(TArray<T>& r)
+template <class T, class AllocatorType>
+auto end(TArray<T, AllocatorType>& r)
 {
 	return r.GetData() + r.Num();
 }
 
-template <class T>
-auto begin(const TArray<T>& r)
+template <class T, class AllocatorType>
+auto begin(const TArray<T, AllocatorType>& r)
 {
 	return r.GetData();
 }
 
-template <class T>
-auto end(const TArray<T>& r)
+template <class T, class AllocatorType>
+auto end(const TArray<T, AllocatorType>& r)
 {
 	return r.GetData() + r.Num();
 }
 
 // optional; compiles fine w/o, but probably better to provide this
-template <class T>
-auto size(const TArray<T>& r)
+template <class T, class AllocatorType>
+auto size(const TArray<T, AllocatorType>& r)
 {
 	return r.Num();
 }
@@ -47,8 +58,206 @@ auto size(const TArray<T>& r)
 //---------------------------------------------------------------------------------------
 
 // optional; compiles fine w/o, but probably better to provide this
-template <class T>
-auto size(const TArrayView<T>& r)
+template <class T, class SizeType>
+auto size(const TArrayView<T, SizeType>& r)
+{
+	return r.Num();
+}
+
+// Views only refer to elements that they don't own, so iterators remain valid after the view itself is destroyed (e.g.
+// when a temporary view is passed to `std::ranges::find`) & views are cheap to copy into pipelines.
+template <class T, class SizeType>
+inline constexpr bool std::ranges::enable_borrowed_range<TArrayView<T, SizeType>> = true;
+
+template <class T, class SizeType>
+inline constexpr bool std::ranges::enable_view<TArrayView<T, SizeType>> = true;
+
+//---------------------------------------------------------------------------------------
+
+// `TSparseArray`, `TSet`, & `TMap` have holes where elements were removed. Their own iterators skip those efficiently,
+// so they're adapted to forward iterators (ending at `std::default_sentinel`) rather than probing every index.
+// Forward iterators can't be subtracted to get the size, so `size` overloads are required for both const & non-const
+// containers (`std::ranges::size` rejects a const overload for non-const containers).
+
+template <class T, class Allocator>
+auto begin(TSparseArray<T, Allocator>& r)
+{
+	return IG::Ranges::Private::TNativeIterator(r.CreateIterator());
+}
+
+template <class T, class Allocator>
+auto end(TSparseArray<T, Allocator>&)
+{
+	return std::default_sentinel;
+}
+
+template <class T, class Allocator>
+auto begin(const TSparseArray<T, Allocator>& r)
+{
+	return IG::Ranges::Private::TNativeIterator(r.CreateConstIterator());
+}
+
+template <class T, class Allocator>
+auto end(const TSparseArray<T, Allocator>&)
+{
+	return std::default_sentinel;
+}
+
+template <class T, class Allocator>
+auto size(TSparseArray<T, Allocator>& r)
+{
+	return r.Num();
+}
+
+template <class T, class Allocator>
+auto size(const TSparseArray<T, Allocator>& r)
+{
+	return r.Num();
+}
+
+//---------------------------------------------------------------------------------------
+
+template <class T, class KeyFuncs, class Allocator>
+auto begin(TSet<T, KeyFuncs, Allocator>& r)
+{
+	return IG::Ranges::Private::TNativeIterator(r.CreateIterator());
+}
+
+template <class T, class KeyFuncs, class Allocator>
+auto end(TSet<T, KeyFuncs, Allocator>&)
+{
+	return std::default_sentinel;
+}
+
+template <class T, class KeyFuncs, class Allocator>
+auto begin(const TSet<T, KeyFuncs, Allocator>& r)
+{
+	return IG::Ranges::Private::TNativeIterator(r.CreateConstIterator());
+}
+
+template <class T, class KeyFuncs, class Allocator>
+auto end(const TSet<T, KeyFuncs, Allocator>&)
+{
+	return std::default_sentinel;
+}
+
+template <class T, class KeyFuncs, class Allocator>
+auto size(TSet<T, KeyFuncs, Allocator>& r)
+{
+	return r.Num();
+}
+
+template <class T, class KeyFuncs, class Allocator>
+auto size(const TSet<T, KeyFuncs, Allocator>& r)
+{
+	return r.Num();
+}
+
+//---------------------------------------------------------------------------------------
+
+// Elements are `TPair<K, V>`; use `Select(&TPair<K, V>::Key)` or `Select(&TPair<K, V>::Value)` to get one or the other.
+
+template <class K, class V, class SetAllocator, class KeyFuncs>
+auto begin(TMap<K, V, SetAllocator, KeyFuncs>& r)
+{
+	return IG::Ranges::Private::TNativeIterator(r.CreateIterator());
+}
+
+template <class K, class V, class SetAllocator, class KeyFuncs>
+auto end(TMap<K, V, SetAllocator, KeyFuncs>&)
+{
+	return std::default_sentinel;
+}
+
+template <class K, class V, class SetAllocator, class KeyFuncs>
+auto begin(const TMap<K, V, SetAllocator, KeyFuncs>& r)
+{
+	return IG::Ranges::Private::TNativeIterator(r.CreateConstIterator());
+}
+
+template <class K, class V, class SetAllocator, class KeyFuncs>
+auto end(const TMap<K, V, SetAllocator, KeyFuncs>&)
+{
+	return std::default_sentinel;
+}
+
+template <class K, class V, class SetAllocator, class KeyFuncs>
+auto size(TMap<K, V, SetAllocator, KeyFuncs>& r)
+{
+	return r.Num();
+}
+
+template <class K, class V, class SetAllocator, class KeyFuncs>
+auto size(const TMap<K, V, SetAllocator, KeyFuncs>& r)
+{
+	return r.Num();
+}
+
+//---------------------------------------------------------------------------------------
+
+// Elements are stored in separately allocated chunks, so this is random-access but not contiguous.
+
+template <class T, uint32 TargetBytesPerChunk, class Allocator>
+auto begin(TChunkedArray<T, TargetBytesPerChunk, Allocator>& r)
+{
+	return IG::Ranges::Private::TIndexIterator<TChunkedArray<T, TargetBytesPerChunk, Allocator>, T&>(r, 0);
+}
+
+template <class T, uint32 TargetBytesPerChunk, class Allocator>
+auto end(TChunkedArray<T, TargetBytesPerChunk, Allocator>& r)
+{
+	return IG::Ranges::Private::TIndexIterator<TChunkedArray<T, TargetBytesPerChunk, Allocator>, T&>(r, r.Num());
+}
+
+template <class T, uint32 TargetBytesPerChunk, class Allocator>
+auto begin(const TChunkedArray<T, TargetBytesPerChunk, Allocator>& r)
+{
+	return IG::Ranges::Private::TIndexIterator<const TChunkedArray<T, TargetBytesPerChunk, Allocator>, const T&>(r, 0);
+}
+
+template <class T, uint32 TargetBytesPerChunk, class Allocator>
+auto end(const TChunkedArray<T, TargetBytesPerChunk, Allocator>& r)
+{
+	return IG::Ranges::Private::TIndexIterator<const TChunkedArray<T, TargetBytesPerChunk, Allocator>, const T&>(r, r.Num());
+}
+
+template <class T, uint32 TargetBytesPerChunk, class Allocator>
+auto size(const TChunkedArray<T, TargetBytesPerChunk, Allocator>& r)
+{
+	return r.Num();
+}
+
+//---------------------------------------------------------------------------------------
+
+// Bits are yielded as `bool` values (read-only), not as `FBitReference` proxies.
+// Non-const overloads are required because `std::ranges::begin` rejects a const overload for non-const containers.
+
+template <class Allocator>
+auto begin(TBitArray<Allocator>& r)
+{
+	return IG::Ranges::Private::TIndexIterator<const TBitArray<Allocator>, bool>(r, 0);
+}
+
+template <class Allocator>
+auto end(TBitArray<Allocator>& r)
+{
+	return IG::Ranges::Private::TIndexIterator<const TBitArray<Allocator>, bool>(r, r.Num());
+}
+
+template <class Allocator>
+auto begin(const TBitArray<Allocator>& r)
+{
+	return IG::Ranges::Private::TIndexIterator<const TBitArray<Allocator>, bool>(r, 0);
+}
+
+template <class Allocator>
+auto end(const TBitArray<Allocator>& r)
+{
+	return IG::Ranges::Private::TIndexIterator<const TBitArray<Allocator>, bool>(r, r.Num());
+}
+
+template <class Allocator>
+auto size(const TBitArray<Allocator>& r)
 {
 	return r.Num();
 }
@@ -0,0 +1,236 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "Containers/Set.h"
+#include "IGRanges/Impl/FilterMapView.h"
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+/**
+ * Set of keys that starts out as a small inline array (searched linearly, never allocates) & switches to a `TSet` once
+ * it holds more than `NumInlineKeys` keys.
+ */
+template <typename KeyType, int32 NumInlineKeys = 16>
+class TSeenKeys
+{
+public:
+	/**
+	 * Adds a key if it hasn't been seen yet.
+	 * Returns True if the key is new; otherwise, False.
+	 */
+	bool Add(KeyType Key)
+	{
+		if (!bUsingSet)
+		{
+			for (const KeyType& SeenKey : InlineKeys)
+			{
+				if (SeenKey == Key)
+				{
+					return false;
+				}
+			}
+
+			if (InlineKeys.Num() < NumInlineKeys)
+			{
+				InlineKeys.Emplace(MoveTemp(Key));
+				return true;
+			}
+
+			Set.Reserve(NumInlineKeys * 4);
+			for (KeyType& SeenKey : InlineKeys)
+			{
+				Set.Emplace(MoveTemp(SeenKey));
+			}
+
+			InlineKeys.Reset();
+			bUsingSet = true;
+		}
+
+		bool bIsAlreadyInSet = false;
+		Set.Emplace(MoveTemp(Key), &bIsAlreadyInSet);
+		return !bIsAlreadyInSet;
+	}
+
+	void Reset()
+	{
+		InlineKeys.Reset();
+		Set.Reset();
+		bUsingSet = false;
+	}
+
+private:
+	TArray<KeyType, TInlineAllocator<NumInlineKeys>> InlineKeys;
+	TSet<KeyType> Set;
+	bool bUsingSet = false;
+};
+
+/**
+ * View that yields the elements of another view whose keys haven't been seen yet (i.e. first occurrences), in order.
+ * The keys that have been seen are kept in the view, so it's an input range: each call to `begin` starts over.
+ */
+template <std::ranges::input_range ViewType, typename KeySelectorType>
+	requires std::ranges::view<ViewType> && std::is_object_v<KeySelectorType>
+class TDistinctView : public std::ranges::view_interface<TDistinctView<ViewType, KeySelectorType>>
+{
+	using KeyType = std::remove_cvref_t<std::invoke_result_t<KeySelectorType&, std::ranges::range_reference_t<ViewType>>>;
+
+	class FIterator
+	{
+	public:
+		using value_type = std::ranges::range_value_t<ViewType>;
+		using difference_type = std::ranges::range_difference_t<ViewType>;
+		using iterator_concept = std::input_iterator_tag;
+
+		FIterator() = default;
+
+		explicit FIterator(TDistinctView& InParent)
+			: Parent(&InParent)
+			, Current(std::ranges::begin(InParent.Base))
+		{
+			Satisfy();
+		}
+
+		[[nodiscard]] decltype(auto) operator*() const
+		{
+			return *Current;
+		}
+
+		FIterator& operator++()
+		{
+			++Current;
+			Satisfy();
+			return *this;
+		}
+
+		void operator++(int)
+		{
+			++*this;
+		}
+
+		[[nodiscard]] friend bool operator==(const FIterator& Lhs, std::default_sentinel_t)
+		{
+			return Lhs.IsAtEnd();
+		}
+
+	private:
+		[[nodiscard]] bool IsAtEnd() const
+		{
+			return Current == std::ranges::end(Parent->Base);
+		}
+
+		void Satisfy()
+		{
+			const auto End = std::ranges::end(Parent->Base);
+			for (; Current != End; ++Current)
+			{
+				if (Parent->SeenKeys.Add(std::invoke(*Parent->KeySelector, *Current)))
+				{
+					return;
+				}
+			}
+		}
+
+		TDistinctView* Parent = nullptr;
+		std::ranges::iterator_t<ViewType> Current = std::ranges::iterator_t<ViewType>();
+	};
+
+public:
+	TDistinctView()
+		requires std::default_initializable<ViewType> && std::default_initializable<KeySelectorType>
+	= default;
+
+	TDistinctView(ViewType InBase, KeySelectorType InKeySelector)
+		: Base(std::move(InBase))
+		, KeySelector(std::move(InKeySelector))
+	{
+	}
+
+	[[nodiscard]] ViewType base() const&
+		requires std::copy_constructible<ViewType>
+	{
+		return Base;
+	}
+
+	[[nodiscard]] ViewType base() &&
+	{
+		return std::move(Base);
+	}
+
+	[[nodiscard]] FIterator begin()
+	{
+		SeenKeys.Reset();
+		return FIterator(*this);
+	}
+
+	[[nodiscard]] std::default_sentinel_t end() const
+	{
+		return std::default_sentinel;
+	}
+
+private:
+	ViewType Base;
+	TMovableBox<KeySelectorType> KeySelector;
+	TSeenKeys<KeyType> SeenKeys;
+};
+
+template <typename RangeType, typename KeySelectorType>
+TDistinctView(RangeType&&, KeySelectorType) -> TDistinctView<std::views::all_t<RangeType>, KeySelectorType>;
+
+struct Distinct_fn
+{
+	template <typename RangeType, typename KeySelectorType>
+		requires std::invocable<std::decay_t<KeySelectorType>&, std::ranges::range_reference_t<RangeType>>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range, KeySelectorType&& KeySelector) const
+	{
+		return _IGRP TDistinctView(std::views::all(std::forward<RangeType>(Range)), std::forward<KeySelectorType>(KeySelector));
+	}
+};
+
+} // namespace Private
+
+/**
+ * Removes duplicate elements from a sequence, yielding the first occurrence of each value in the order of the range.
+ * Elements must be comparable with `operator==` & hashable with `GetTypeHash`.
+ *
+ * Evaluated lazily: the values that have been seen are kept in a small inline buffer (no allocations) until there are
+ * more than a handful of them & in a `TSet` after that, so pipelines that stop early (e.g. `Distinct() | Take(N)` or
+ * `Distinct() | FirstOrDefault(pred)`) only pay for the elements that they visit.
+ * The view is single-pass; iterating it again starts over.
+ *
+ * @usage
+ * SomeNumbers | Distinct()
+ * SomeActors | Select(&AActor::GetClass) | Distinct()
+ */
+[[nodiscard]] inline constexpr auto Distinct()
+{
+	return std::ranges::_Range_closure<_IGRP Distinct_fn, std::identity>{std::identity()};
+}
+
+/**
+ * Same as `Distinct` but compares the keys produced by a key selector instead of the elements themselves.
+ * The first element with each key is yielded.
+ *
+ * @usage
+ * SomeActors | DistinctBy(&AActor::GetClass)
+ * SomeStructs | DistinctBy([](const FBar& B) { return B.GetId(); })
+ */
+template <typename KeySelectorType>
+[[nodiscard]] constexpr auto DistinctBy(KeySelectorType&& KeySelector)
+{
+	return std::ranges::_Range_closure<_IGRP Distinct_fn, std::decay_t<KeySelectorType>>{std::forward<KeySelectorType>(KeySelector)};
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
@@ -0,0 +1,50 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "IGRanges/Impl/FilterMapView.h"
+#include <functional>
+#include <ranges>
+#include <type_traits>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+struct FilterMap_fn
+{
+	template <typename RangeType, typename FuncType>
+		requires std::invocable<std::decay_t<FuncType>&, std::ranges::range_reference_t<RangeType>>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range, FuncType&& Func) const
+	{
+		return _IGRP TFilterMapView(std::views::all(std::forward<RangeType>(Range)), std::forward<FuncType>(Func));
+	}
+};
+
+} // namespace Private
+
+/**
+ * Projects each element of a sequence into a new form & filters out the projections that are empty.
+ * Projections may return pointer-like values (raw pointers, `TObjectPtr`, `TSharedPtr`, `TWeakPtr`, etc.), which are
+ * filtered out when they're Null, or `TOptional` values, which are filtered out when they're unset & otherwise yield the
+ * value that they hold.
+ *
+ * Similar to `Select(proj) | NonNull()`, except that the projection is invoked exactly once per element.
+ *
+ * @usage
+ * SomeActors | FilterMap([](const AActor* A) { return A->FindComponentByClass<UMyComponent>(); })
+ * SomeStrings | FilterMap([](const FString& S) -> TOptional<int32> {
+ *     return S.IsNumeric() ? TOptional<int32>(FCString::Atoi(*S)) : NullOpt;
+ * })
+ */
+template <typename FuncType>
+[[nodiscard]] constexpr auto FilterMap(FuncType&& Func)
+{
+	return std::ranges::_Range_closure<_IGRP FilterMap_fn, std::decay_t<FuncType>>{std::forward<FuncType>(Func)};
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
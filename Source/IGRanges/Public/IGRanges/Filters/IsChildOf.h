@@ -2,11 +2,13 @@
 
 #pragma once
 
+#include "IGRanges/Impl/ChildOfAnyCache.h"
 #include "IGRanges/Impl/Common.h"
 #include "Templates/SubclassOf.h"
 #include "UObject/Class.h"
 #include "UObject/SoftObjectPtr.h"
 #include "UObject/WeakObjectPtrTemplates.h"
+#include <initializer_list>
 
 #include "IGRanges/Impl/Prologue.inl"
 
@@ -82,6 +84,36 @@ template <typename T>
 	return _IGR Filters::IsChildOf(T::StaticClass());
 }
 
+/**
+ * Filter that tests whether a UClass-like value is a child of any of the specified classes.
+ * Safe to use with null inputs.
+ *
+ * Each distinct class is tested against the bases once & the result is remembered, so later elements with the same class
+ * take constant time regardless of the number of bases.
+ *
+ * This filter is expected to be used with the same types as `IsChildOf`.
+ *
+ * @usage SomeClasses | Where(Filters::IsChildOfAny({FooClass, BarClass, BazClass}))
+ */
+[[nodiscard]] inline auto IsChildOfAny(std::initializer_list<const UStruct*> Bases)
+{
+	return [Cache = _IGRP FChildOfAnyCache(Bases)](auto&& x) {
+		return Cache.IsChildOfAny(_IGRP AsStructPointer(x));
+	};
+}
+
+/**
+ * Filter that tests whether a UClass-like value is a child of any of the specified classes.
+ * Safe to use with null inputs.
+ *
+ * @usage SomeClasses | Where(Filters::IsChildOfAny<UFoo, UBar, UBaz>())
+ */
+template <typename... Ts>
+[[nodiscard]] auto IsChildOfAny()
+{
+	return _IGR Filters::IsChildOfAny({Ts::StaticClass()...});
+}
+
 } // namespace Filters
 
 } // namespace IG::Ranges
@@ -15,6 +15,7 @@ namespace Private
 struct FirstOrDefault_fn
 {
 	template <typename RangeType, class _Pr>
+		requires std::ranges::input_range<RangeType>
 	[[nodiscard]] constexpr auto operator()(RangeType&& Range, _Pr _Pred) const
 	{
 		using T = std::ranges::range_value_t<RangeType>;
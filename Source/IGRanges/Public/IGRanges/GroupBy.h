@@ -0,0 +1,212 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "HAL/Platform.h" // `int32`
+#include "Templates/TypeHash.h"
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+template <typename AggregatorType, typename ElementType>
+concept Aggregator = requires(const AggregatorType& Agg, ElementType&& Elem, decltype(Agg.First(std::declval<ElementType>()))& Acc) {
+	Agg.Next(Acc, std::forward<ElementType>(Elem));
+};
+
+struct GroupBy_fn
+{
+	template <typename RangeType, typename KeySelectorType, typename AggregatorType>
+		requires std::invocable<KeySelectorType&, std::ranges::range_reference_t<RangeType>>
+				 && _IGRP Aggregator<AggregatorType, std::ranges::range_reference_t<RangeType>>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range, KeySelectorType&& KeySelector, const AggregatorType& Agg) const
+	{
+		using ReferenceType = std::ranges::range_reference_t<RangeType>;
+		using KeyType = std::remove_cvref_t<std::invoke_result_t<KeySelectorType&, ReferenceType>>;
+		using AccumulatorType = std::remove_cvref_t<decltype(Agg.First(std::declval<ReferenceType>()))>;
+
+		// Groups are usually far fewer than elements, so the map isn't reserved from the size of the range.
+		TMap<KeyType, AccumulatorType> Map;
+		for (auto&& X : Range)
+		{
+			KeyType Key = std::invoke(KeySelector, X);
+
+			// Hash each key once for both the lookup & (for new groups) the insertion.
+			const uint32 KeyHash = GetTypeHash(Key);
+			if (AccumulatorType* Acc = Map.FindByHash(KeyHash, Key))
+			{
+				Agg.Next(*Acc, std::forward<decltype(X)>(X));
+			}
+			else
+			{
+				Map.EmplaceByHash(KeyHash, std::move(Key), Agg.First(std::forward<decltype(X)>(X)));
+			}
+		}
+
+		return Map;
+	}
+};
+
+struct CountAggregator
+{
+	template <typename T>
+	[[nodiscard]] constexpr int32 First(T&&) const
+	{
+		return 1;
+	}
+
+	template <typename T>
+	constexpr void Next(int32& Acc, T&&) const
+	{
+		++Acc;
+	}
+};
+
+template <typename ProjectionType>
+struct TSumAggregator
+{
+	template <typename T>
+	[[nodiscard]] constexpr auto First(T&& Elem) const
+	{
+		return std::remove_cvref_t<std::invoke_result_t<const ProjectionType&, T>>(std::invoke(Proj, std::forward<T>(Elem)));
+	}
+
+	template <typename AccumulatorType, typename T>
+	constexpr void Next(AccumulatorType& Acc, T&& Elem) const
+	{
+		Acc = std::move(Acc) + std::invoke(Proj, std::forward<T>(Elem));
+	}
+
+	ProjectionType Proj;
+};
+
+template <typename ProjectionType, typename CompareType>
+struct TBestAggregator
+{
+	template <typename T>
+	[[nodiscard]] constexpr auto First(T&& Elem) const
+	{
+		return std::remove_cvref_t<std::invoke_result_t<const ProjectionType&, T>>(std::invoke(Proj, std::forward<T>(Elem)));
+	}
+
+	template <typename AccumulatorType, typename T>
+	constexpr void Next(AccumulatorType& Acc, T&& Elem) const
+	{
+		decltype(auto) Value = std::invoke(Proj, std::forward<T>(Elem));
+		if (CompareType()(Value, Acc))
+		{
+			Acc = std::forward<decltype(Value)>(Value);
+		}
+	}
+
+	ProjectionType Proj;
+};
+
+template <typename SeedType, typename FoldType>
+struct TFoldAggregator
+{
+	template <typename T>
+	[[nodiscard]] constexpr SeedType First(T&& Elem) const
+	{
+		return std::invoke(Fold, Seed, std::forward<T>(Elem));
+	}
+
+	template <typename T>
+	constexpr void Next(SeedType& Acc, T&& Elem) const
+	{
+		Acc = std::invoke(Fold, std::move(Acc), std::forward<T>(Elem));
+	}
+
+	SeedType Seed;
+	FoldType Fold;
+};
+
+} // namespace Private
+
+namespace Aggregators
+{
+/**
+ * Aggregator for `GroupBy` that counts the elements in each group (as `int32`).
+ *
+ * @usage SomeActors | GroupBy(&AActor::GetClass, Aggregators::Count())
+ */
+[[nodiscard]] inline constexpr auto Count()
+{
+	return _IGRP CountAggregator();
+}
+
+/**
+ * Aggregator for `GroupBy` that sums the elements (or projections of the elements) in each group with `operator+`.
+ *
+ * @usage SomeStructs | GroupBy(&FBar::Category, Aggregators::Sum(&FBar::Weight))
+ */
+template <typename ProjectionType = std::identity>
+[[nodiscard]] constexpr auto Sum(ProjectionType Proj = {})
+{
+	return _IGRP TSumAggregator<ProjectionType>{std::move(Proj)};
+}
+
+/**
+ * Aggregator for `GroupBy` that keeps the smallest element (or projection of the elements) in each group.
+ *
+ * @usage SomeStructs | GroupBy(&FBar::Category, Aggregators::Min(&FBar::Weight))
+ */
+template <typename ProjectionType = std::identity>
+[[nodiscard]] constexpr auto Min(ProjectionType Proj = {})
+{
+	return _IGRP TBestAggregator<ProjectionType, std::less<>>{std::move(Proj)};
+}
+
+/**
+ * Aggregator for `GroupBy` that keeps the largest element (or projection of the elements) in each group.
+ *
+ * @usage SomeStructs | GroupBy(&FBar::Category, Aggregators::Max(&FBar::Weight))
+ */
+template <typename ProjectionType = std::identity>
+[[nodiscard]] constexpr auto Max(ProjectionType Proj = {})
+{
+	return _IGRP TBestAggregator<ProjectionType, std::greater<>>{std::move(Proj)};
+}
+
+/**
+ * Aggregator for `GroupBy` that folds the elements of each group, starting from a copy of the seed (same as
+ * `Accumulate`).
+ *
+ * @usage SomeStructs | GroupBy(&FBar::Category, Aggregators::Fold(FString(), [](FString S, const FBar& B) { return S + B.Name; }))
+ */
+template <typename SeedType, typename FoldType>
+[[nodiscard]] constexpr auto Fold(SeedType Seed, FoldType Func)
+{
+	return _IGRP TFoldAggregator<SeedType, FoldType>{std::move(Seed), std::move(Func)};
+}
+
+} // namespace Aggregators
+
+/**
+ * Groups the elements of a range by key & aggregates each group, producing a `TMap` from keys to aggregates.
+ * The range is traversed once & no intermediate containers are created.
+ *
+ * Aggregators are found in the `Aggregators` namespace (`Count`, `Sum`, `Min`, `Max`, & `Fold`).
+ *
+ * @usage
+ * TMap<UClass*, int32> NumActorsPerClass = SomeActors | GroupBy(&AActor::GetClass, Aggregators::Count());
+ * TMap<FName, float> TotalWeights = SomeStructs | GroupBy(&FBar::Category, Aggregators::Sum(&FBar::Weight));
+ */
+template <typename KeySelectorType, typename AggregatorType>
+[[nodiscard]] constexpr auto GroupBy(KeySelectorType&& KeySelector, AggregatorType&& Agg)
+{
+	return std::ranges::_Range_closure<_IGRP GroupBy_fn, std::decay_t<KeySelectorType>, std::decay_t<AggregatorType>>{
+		std::forward<KeySelectorType>(KeySelector),
+		std::forward<AggregatorType>(Agg)};
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
@@ -0,0 +1,172 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Platform.h" // `UPTRINT`
+#include "Misc/ScopeLock.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/Class.h"
+#include <atomic>
+#include <initializer_list>
+
+namespace IG::Ranges::Private
+{
+/**
+ * Tests whether structs (usually classes) are children of any of several bases, remembering the result for each struct
+ * that's tested. Elements are tested against every base once; after that, testing a struct is a single lookup no matter
+ * how many bases there are.
+ *
+ * Copies share the results (e.g. when a filter is copied into a view or its iterators), so each struct is only tested
+ * once per cache no matter how many copies or tasks iterate a range.
+ */
+class FChildOfAnyCache
+{
+public:
+	explicit FChildOfAnyCache(std::initializer_list<const UStruct*> InBases)
+		: Memo(MakeShared<FMemo>(InBases))
+	{
+	}
+
+	[[nodiscard]] bool IsChildOfAny(const UStruct* Struct) const
+	{
+		if (Struct == nullptr)
+		{
+			return false;
+		}
+
+		return Memo->IsChildOfAny(Struct);
+	}
+
+private:
+	/**
+	 * Open-addressing table of struct pointers with the result packed into the low bit (structs are aligned, so it's
+	 * free). Entries are only ever added, so lookups don't lock & don't write anything; only the first test of each
+	 * struct takes the lock to add its entry. The table doubles in size when it's half full. Older tables are kept until
+	 * the memo is destroyed since other threads may still be reading them (they're at most as big as the current table).
+	 */
+	class FMemo
+	{
+	public:
+		explicit FMemo(std::initializer_list<const UStruct*> InBases)
+			: Bases(InBases)
+		{
+			Tables.Emplace(MakeUnique<FTable>(InitialCapacity));
+			CurrentTable = Tables.Last().Get();
+		}
+
+		[[nodiscard]] bool IsChildOfAny(const UStruct* Struct)
+		{
+			const UPTRINT StructBits = reinterpret_cast<UPTRINT>(Struct);
+
+			const UPTRINT Found = CurrentTable.load(std::memory_order_acquire)->Find(StructBits);
+			if (Found != 0)
+			{
+				return (Found & 1) != 0;
+			}
+
+			bool bMatch = false;
+			for (const UStruct* Base : Bases)
+			{
+				if (Struct->IsChildOf(Base))
+				{
+					bMatch = true;
+					break;
+				}
+			}
+
+			Add(StructBits | UPTRINT(bMatch));
+			return bMatch;
+		}
+
+	private:
+		struct FTable
+		{
+			explicit FTable(int32 InCapacity)
+				: Entries(MakeUnique<std::atomic<UPTRINT>[]>(InCapacity))
+				, Capacity(InCapacity)
+			{
+			}
+
+			/** Gets the entry for a struct, or zero if it hasn't been added. */
+			[[nodiscard]] UPTRINT Find(UPTRINT StructBits) const
+			{
+				for (int32 i = GetFirstIndex(StructBits);; i = (i + 1) & (Capacity - 1))
+				{
+					const UPTRINT Entry = Entries[i].load(std::memory_order_relaxed);
+					if (Entry == 0 || (Entry & ~UPTRINT(1)) == StructBits)
+					{
+						return Entry;
+					}
+				}
+			}
+
+			/** Adds an entry for a struct that isn't in the table yet. */
+			void Add(UPTRINT Entry)
+			{
+				int32 i = GetFirstIndex(Entry & ~UPTRINT(1));
+				while (Entries[i].load(std::memory_order_relaxed) != 0)
+				{
+					i = (i + 1) & (Capacity - 1);
+				}
+
+				Entries[i].store(Entry, std::memory_order_relaxed);
+				++Num;
+			}
+
+			[[nodiscard]] int32 GetFirstIndex(UPTRINT StructBits) const
+			{
+				return static_cast<int32>((StructBits >> 4) & (Capacity - 1));
+			}
+
+			TUniquePtr<std::atomic<UPTRINT>[]> Entries;
+			int32 Capacity = 0;
+			int32 Num = 0;
+		};
+
+		static constexpr int32 InitialCapacity = 64;
+
+		void Add(UPTRINT Entry)
+		{
+			FScopeLock Lock(&TablesLock);
+
+			FTable* Table = Tables.Last().Get();
+
+			// Another thread may have added the same struct since it was looked up.
+			if (Table->Find(Entry & ~UPTRINT(1)) != 0)
+			{
+				return;
+			}
+
+			if ((Table->Num + 1) * 2 > Table->Capacity)
+			{
+				TUniquePtr<FTable> Grown = MakeUnique<FTable>(Table->Capacity * 2);
+				for (int32 i = 0; i < Table->Capacity; ++i)
+				{
+					if (const UPTRINT Existing = Table->Entries[i].load(std::memory_order_relaxed))
+					{
+						Grown->Add(Existing);
+					}
+				}
+
+				Table = Grown.Get();
+				Tables.Emplace(MoveTemp(Grown));
+			}
+
+			Table->Add(Entry);
+			CurrentTable.store(Table, std::memory_order_release);
+		}
+
+		TArray<const UStruct*, TInlineAllocator<4>> Bases;
+		TArray<TUniquePtr<FTable>, TInlineAllocator<4>> Tables;
+		std::atomic<FTable*> CurrentTable = nullptr;
+		FCriticalSection TablesLock;
+	};
+
+	TSharedRef<FMemo> Memo;
+};
+
+} // namespace IG::Ranges::Private
@@ -0,0 +1,182 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "HAL/Platform.h"
+#include "Misc/Optional.h"
+#include <compare>
+#include <iterator>
+#include <type_traits>
+
+namespace IG::Ranges::Private
+{
+/**
+ * Adapts one of Unreal's own container iterators (e.g. `TSet<T>::TConstIterator`) to a C++20 forward iterator.
+ * The end of the range is represented by `std::default_sentinel` & is reached when the wrapped iterator converts to
+ * `false`.
+ *
+ * The wrapped iterators already skip unallocated slots of `TSparseArray`-backed containers by scanning the allocation
+ * flags a word at a time, so they are much faster for sparse containers than probing every index.
+ */
+template <typename NativeIteratorType>
+class TNativeIterator
+{
+public:
+	using reference = decltype(*std::declval<const NativeIteratorType&>());
+	using value_type = std::remove_cvref_t<reference>;
+	using difference_type = std::ptrdiff_t;
+	using iterator_concept = std::forward_iterator_tag;
+	using iterator_category = std::forward_iterator_tag;
+
+	TNativeIterator() = default;
+
+	explicit TNativeIterator(NativeIteratorType&& InIt)
+		: It(MoveTemp(InIt))
+	{
+	}
+
+	[[nodiscard]] reference operator*() const
+	{
+		return **It;
+	}
+
+	TNativeIterator& operator++()
+	{
+		++*It;
+		return *this;
+	}
+
+	TNativeIterator operator++(int)
+	{
+		TNativeIterator Tmp = *this;
+		++*this;
+		return Tmp;
+	}
+
+	[[nodiscard]] friend bool operator==(const TNativeIterator& Lhs, const TNativeIterator& Rhs)
+	{
+		const bool bLhsEnded = (Lhs == std::default_sentinel);
+		const bool bRhsEnded = (Rhs == std::default_sentinel);
+		return (bLhsEnded || bRhsEnded) ? (bLhsEnded == bRhsEnded) : (*Lhs.It == *Rhs.It);
+	}
+
+	[[nodiscard]] friend bool operator==(const TNativeIterator& Lhs, std::default_sentinel_t)
+	{
+		return !Lhs.It.IsSet() || !static_cast<bool>(*Lhs.It);
+	}
+
+private:
+	// Unreal's iterators hold a reference to their container, so they can't be default-constructed or assigned.
+	// `TOptional` provides both (assignment re-constructs the wrapped iterator).
+	TOptional<NativeIteratorType> It;
+};
+
+template <typename NativeIteratorType>
+TNativeIterator(NativeIteratorType&&) -> TNativeIterator<std::remove_cvref_t<NativeIteratorType>>;
+
+/**
+ * Random-access iterator for containers that are indexed by `int32` but aren't contiguous (e.g. `TChunkedArray`).
+ * Dereferencing yields `(*Container)[Index]` converted to `ReferenceType` (e.g. `bool` for `TBitArray`).
+ */
+template <typename ContainerType, typename ReferenceType>
+class TIndexIterator
+{
+public:
+	using reference = ReferenceType;
+	using value_type = std::remove_cvref_t<ReferenceType>;
+	using difference_type = std::ptrdiff_t;
+	using iterator_concept = std::random_access_iterator_tag;
+	using iterator_category = std::conditional_t<std::is_reference_v<ReferenceType>, std::random_access_iterator_tag, std::input_iterator_tag>;
+
+	TIndexIterator() = default;
+
+	TIndexIterator(ContainerType& InContainer, int32 InIndex)
+		: Container(&InContainer)
+		, Index(InIndex)
+	{
+	}
+
+	[[nodiscard]] reference operator*() const
+	{
+		return static_cast<reference>((*Container)[Index]);
+	}
+
+	[[nodiscard]] reference operator[](difference_type Offset) const
+	{
+		return static_cast<reference>((*Container)[Index + static_cast<int32>(Offset)]);
+	}
+
+	TIndexIterator& operator++()
+	{
+		++Index;
+		return *this;
+	}
+
+	TIndexIterator operator++(int)
+	{
+		TIndexIterator Tmp = *this;
+		++Index;
+		return Tmp;
+	}
+
+	TIndexIterator& operator--()
+	{
+		--Index;
+		return *this;
+	}
+
+	TIndexIterator operator--(int)
+	{
+		TIndexIterator Tmp = *this;
+		--Index;
+		return Tmp;
+	}
+
+	TIndexIterator& operator+=(difference_type Offset)
+	{
+		Index += static_cast<int32>(Offset);
+		return *this;
+	}
+
+	TIndexIterator& operator-=(difference_type Offset)
+	{
+		Index -= static_cast<int32>(Offset);
+		return *this;
+	}
+
+	[[nodiscard]] friend TIndexIterator operator+(TIndexIterator It, difference_type Offset)
+	{
+		return It += Offset;
+	}
+
+	[[nodiscard]] friend TIndexIterator operator+(difference_type Offset, TIndexIterator It)
+	{
+		return It += Offset;
+	}
+
+	[[nodiscard]] friend TIndexIterator operator-(TIndexIterator It, difference_type Offset)
+	{
+		return It -= Offset;
+	}
+
+	[[nodiscard]] friend difference_type operator-(const TIndexIterator& Lhs, const TIndexIterator& Rhs)
+	{
+		return static_cast<difference_type>(Lhs.Index) - static_cast<difference_type>(Rhs.Index);
+	}
+
+	[[nodiscard]] friend bool operator==(const TIndexIterator& Lhs, const TIndexIterator& Rhs)
+	{
+		return Lhs.Index == Rhs.Index;
+	}
+
+	[[nodiscard]] friend std::strong_ordering operator<=>(const TIndexIterator& Lhs, const TIndexIterator& Rhs)
+	{
+		return Lhs.Index <=> Rhs.Index;
+	}
+
+private:
+	ContainerType* Container = nullptr;
+	int32 Index = 0;
+};
+
+} // namespace IG::Ranges::Private
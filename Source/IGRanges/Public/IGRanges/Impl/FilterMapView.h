@@ -0,0 +1,325 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "Misc/Optional.h"
+#include "Templates/SharedPointer.h"
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges::Private
+{
+/**
+ * Holds a function object in a view while keeping the view assignable, even if the function object isn't (e.g.
+ * lambdas with captures). Assignment destroys the held object & copy-constructs the new one in its place.
+ */
+template <typename T>
+class TMovableBox
+{
+public:
+	TMovableBox()
+		requires std::default_initializable<T>
+		: Value(T())
+	{
+	}
+
+	explicit TMovableBox(const T& InValue)
+		: Value(InValue)
+	{
+	}
+
+	explicit TMovableBox(T&& InValue)
+		: Value(std::move(InValue))
+	{
+	}
+
+	TMovableBox(const TMovableBox&) = default;
+
+	TMovableBox& operator=(const TMovableBox& Other)
+	{
+		if (this != &Other)
+		{
+			Value.Reset();
+			Value.Emplace(*Other.Value);
+		}
+
+		return *this;
+	}
+
+	[[nodiscard]] T& operator*()
+	{
+		return *Value;
+	}
+
+	[[nodiscard]] const T& operator*() const
+	{
+		return *Value;
+	}
+
+private:
+	TOptional<T> Value;
+};
+
+/**
+ * Describes how `TFilterMapView` tests & unwraps the results of its function, & what its iterators yield.
+ * Pointer-like results (raw pointers, `TObjectPtr`, `TSharedPtr`, etc.) are kept if they aren't null & yielded as is.
+ *
+ * `bStashing` is true when what the iterator yields is only valid while the iterator holds the result (e.g. a reference
+ * to an object that the result keeps alive). Such iterators stay forward-only because `std::views::reverse` yields
+ * through a temporary iterator.
+ */
+template <typename T>
+struct TFilterMapResult
+{
+	using ValueType = T;
+	using ReferenceType = T;
+
+	static constexpr bool bStashing = false;
+
+	[[nodiscard]] static constexpr bool IsSome(const T& Result)
+	{
+		if constexpr (TIsTWeakPtr_V<T>) // Support for `TWeakPtr`
+		{
+			return Result.IsValid();
+		}
+		else
+		{
+			return Result != nullptr;
+		}
+	}
+
+	[[nodiscard]] static constexpr const T& Unwrap(const T& Result)
+	{
+		return Result;
+	}
+};
+
+/**
+ * `TOptional` results are kept if they're set & yielded as the value that they hold.
+ */
+template <typename T>
+struct TFilterMapResult<TOptional<T>>
+{
+	using ValueType = T;
+	using ReferenceType = T;
+
+	static constexpr bool bStashing = false;
+
+	[[nodiscard]] static constexpr bool IsSome(const TOptional<T>& Result)
+	{
+		return Result.IsSet();
+	}
+
+	[[nodiscard]] static constexpr const T& Unwrap(const TOptional<T>& Result)
+	{
+		return *Result;
+	}
+};
+
+/**
+ * View that applies a function to each element of another view, skips the elements whose result is null (or an unset
+ * `TOptional`) & yields the rest of the results.
+ *
+ * Unlike `transform | filter`, the function is invoked exactly once per element: the iterator keeps the result that it
+ * tested & dereferencing yields (a copy of) that result, or whatever `TFilterMapResult` unwraps it to. Iterators are
+ * bidirectional if the underlying view is (so the view can be reversed) & the result isn't stashing, but never random
+ * access since every step may skip any number of elements.
+ *
+ * `begin` searches for the first result each time it's called; it isn't cached like `std::ranges::filter_view`, which
+ * also means that const views can be iterated.
+ */
+template <std::ranges::input_range ViewType, typename FuncType>
+	requires std::ranges::view<ViewType> && std::is_object_v<FuncType>
+class TFilterMapView : public std::ranges::view_interface<TFilterMapView<ViewType, FuncType>>
+{
+	template <bool bConst>
+	class TIterator
+	{
+		using ParentType = std::conditional_t<bConst, const TFilterMapView, TFilterMapView>;
+		using BaseType = std::conditional_t<bConst, const ViewType, ViewType>;
+		using BaseIteratorType = std::ranges::iterator_t<BaseType>;
+
+		friend TFilterMapView;
+
+		using ResultType = std::remove_cvref_t<std::invoke_result_t<std::conditional_t<bConst, const FuncType&, FuncType&>, std::ranges::range_reference_t<BaseType>>>;
+		using ResultTraits = TFilterMapResult<ResultType>;
+
+		static constexpr bool bBidirectional = std::ranges::bidirectional_range<BaseType> && !ResultTraits::bStashing;
+
+	public:
+		using value_type = typename ResultTraits::ValueType;
+		using reference = typename ResultTraits::ReferenceType;
+		using difference_type = std::ranges::range_difference_t<BaseType>;
+		using iterator_concept = std::conditional_t<
+			bBidirectional,
+			std::bidirectional_iterator_tag,
+			std::conditional_t<std::ranges::forward_range<BaseType>, std::forward_iterator_tag, std::input_iterator_tag>>;
+		using iterator_category = std::input_iterator_tag;
+
+		TIterator() = default;
+
+		[[nodiscard]] reference operator*() const
+		{
+			return ResultTraits::Unwrap(Result);
+		}
+
+		TIterator& operator++()
+		{
+			++Current;
+			Satisfy();
+			return *this;
+		}
+
+		void operator++(int)
+		{
+			++*this;
+		}
+
+		TIterator operator++(int)
+			requires std::ranges::forward_range<BaseType>
+		{
+			TIterator Tmp = *this;
+			++*this;
+			return Tmp;
+		}
+
+		TIterator& operator--()
+			requires bBidirectional
+		{
+			// Like `std::ranges::filter_view`, there must be a previous result to move to.
+			do
+			{
+				--Current;
+				Result = std::invoke(*Parent->Func, *Current);
+			} while (!ResultTraits::IsSome(Result));
+
+			return *this;
+		}
+
+		TIterator operator--(int)
+			requires bBidirectional
+		{
+			TIterator Tmp = *this;
+			--*this;
+			return Tmp;
+		}
+
+		[[nodiscard]] friend bool operator==(const TIterator& Lhs, const TIterator& Rhs)
+			requires std::equality_comparable<BaseIteratorType>
+		{
+			return Lhs.Current == Rhs.Current;
+		}
+
+		[[nodiscard]] friend bool operator==(const TIterator& Lhs, const std::ranges::sentinel_t<BaseType>& Rhs)
+			requires(!std::ranges::common_range<BaseType>)
+		{
+			return Lhs.Current == Rhs;
+		}
+
+	private:
+		TIterator(ParentType& InParent, BaseIteratorType InCurrent)
+			: Parent(&InParent)
+			, Current(std::move(InCurrent))
+		{
+			Satisfy();
+		}
+
+		// The end iterator of common ranges; doesn't invoke the function.
+		TIterator(ParentType& InParent, BaseIteratorType InCurrent, std::default_sentinel_t)
+			: Parent(&InParent)
+			, Current(std::move(InCurrent))
+		{
+		}
+
+		void Satisfy()
+		{
+			const auto End = std::ranges::end(Parent->Base);
+			for (; Current != End; ++Current)
+			{
+				Result = std::invoke(*Parent->Func, *Current);
+				if (ResultTraits::IsSome(Result))
+				{
+					return;
+				}
+			}
+		}
+
+		ParentType* Parent = nullptr;
+		BaseIteratorType Current = BaseIteratorType();
+		ResultType Result = ResultType();
+	};
+
+public:
+	TFilterMapView()
+		requires std::default_initializable<ViewType> && std::default_initializable<FuncType>
+	= default;
+
+	TFilterMapView(ViewType InBase, FuncType InFunc)
+		: Base(std::move(InBase))
+		, Func(std::move(InFunc))
+	{
+	}
+
+	[[nodiscard]] ViewType base() const&
+		requires std::copy_constructible<ViewType>
+	{
+		return Base;
+	}
+
+	[[nodiscard]] ViewType base() &&
+	{
+		return std::move(Base);
+	}
+
+	[[nodiscard]] TIterator<false> begin()
+	{
+		return TIterator<false>(*this, std::ranges::begin(Base));
+	}
+
+	[[nodiscard]] TIterator<true> begin() const
+		requires std::ranges::input_range<const ViewType> && std::invocable<const FuncType&, std::ranges::range_reference_t<const ViewType>>
+	{
+		return TIterator<true>(*this, std::ranges::begin(Base));
+	}
+
+	[[nodiscard]] auto end()
+	{
+		if constexpr (std::ranges::common_range<ViewType>)
+		{
+			return TIterator<false>(*this, std::ranges::end(Base), std::default_sentinel);
+		}
+		else
+		{
+			return std::ranges::end(Base);
+		}
+	}
+
+	[[nodiscard]] auto end() const
+		requires std::ranges::input_range<const ViewType> && std::invocable<const FuncType&, std::ranges::range_reference_t<const ViewType>>
+	{
+		if constexpr (std::ranges::common_range<const ViewType>)
+		{
+			return TIterator<true>(*this, std::ranges::end(Base), std::default_sentinel);
+		}
+		else
+		{
+			return std::ranges::end(Base);
+		}
+	}
+
+private:
+	ViewType Base;
+	TMovableBox<FuncType> Func;
+};
+
+template <typename RangeType, typename FuncType>
+TFilterMapView(RangeType&&, FuncType) -> TFilterMapView<std::views::all_t<RangeType>, FuncType>;
+
+} // namespace IG::Ranges::Private
+
+#include "IGRanges/Impl/Epilogue.inl"
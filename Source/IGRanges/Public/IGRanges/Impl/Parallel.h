@@ -0,0 +1,180 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Array.h"
+#include "Math/UnrealMathUtility.h"
+#include <atomic>
+#include <ranges>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+/**
+ * Options that control how the "Parallel" terminals split a range into tasks.
+ */
+struct FParallelOptions
+{
+	/**
+	 * Maximum number of tasks that a range is split into.
+	 * Zero (the default) means one task per task graph worker thread, plus one for the calling thread.
+	 */
+	int32 MaxTasks = 0;
+
+	/**
+	 * Minimum number of elements that each task processes.
+	 * Small ranges are split into fewer tasks (or processed entirely by the calling thread) so that scheduling
+	 * overhead does not dominate the actual work.
+	 */
+	int32 MinElementsPerTask = 4096;
+};
+
+namespace Private
+{
+/**
+ * Ranges that can be split into independent chunks by index.
+ * e.g. `TArray`, `TArrayView`, or `Select` applied to one of those.
+ */
+template <typename RangeType>
+concept ParallelizableRange = std::ranges::random_access_range<RangeType> && std::ranges::sized_range<RangeType>;
+
+/**
+ * Describes how a range of `Num` elements is split into contiguous, evenly sized chunks (one per task).
+ * Chunks are never empty unless the range itself is empty.
+ */
+struct FParallelChunks
+{
+	FParallelChunks(int64 InNum, const FParallelOptions& Options)
+		: Num(InNum)
+	{
+		const int32 MaxTasks = (Options.MaxTasks > 0) ? Options.MaxTasks : (FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+		const int64 MinElementsPerTask = FMath::Max(Options.MinElementsPerTask, 1);
+		NumTasks = static_cast<int32>(FMath::Clamp<int64>(Num / MinElementsPerTask, 1, MaxTasks));
+	}
+
+	[[nodiscard]] int64 GetBegin(int32 TaskIndex) const
+	{
+		return Num * TaskIndex / NumTasks;
+	}
+
+	[[nodiscard]] int64 GetEnd(int32 TaskIndex) const
+	{
+		return Num * (TaskIndex + 1) / NumTasks;
+	}
+
+	int64 Num = 0;
+	int32 NumTasks = 1;
+};
+
+/**
+ * Invokes `Body(TaskIndex, Begin, End)` for every chunk, potentially in parallel.
+ * Blocks until all chunks have been processed.
+ */
+template <typename BodyType>
+void ParallelForEachChunk(const FParallelChunks& Chunks, const BodyType& Body)
+{
+	// Every chunk is already sized for one task, so ask `ParallelFor` not to batch them any further.
+	const EParallelForFlags Flags = (Chunks.NumTasks > 1) ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread;
+	ParallelFor(
+		Chunks.NumTasks,
+		[&Chunks, &Body](int32 TaskIndex) {
+			Body(TaskIndex, Chunks.GetBegin(TaskIndex), Chunks.GetEnd(TaskIndex));
+		},
+		Flags);
+}
+
+/**
+ * Describes how a range is split into more chunks than there are tasks. Each task claims the next unprocessed chunk
+ * until none are left, so tasks that finish early (e.g. because most of their elements were filtered out) take work
+ * from the others instead of sitting idle.
+ */
+struct FClaimableChunks
+{
+	FClaimableChunks(int64 InNum, const FParallelOptions& Options, int32 ChunksPerTask)
+		: Tasks(InNum, Options)
+		, Chunks(InNum, MakeChunkOptions(Tasks, Options, ChunksPerTask))
+	{
+	}
+
+	[[nodiscard]] int32 GetNumChunks() const
+	{
+		return Chunks.NumTasks;
+	}
+
+	FParallelChunks Tasks;
+	FParallelChunks Chunks;
+
+private:
+	[[nodiscard]] static FParallelOptions MakeChunkOptions(const FParallelChunks& Tasks, const FParallelOptions& Options, int32 ChunksPerTask)
+	{
+		// There's nothing to balance when the calling thread processes everything.
+		if (Tasks.NumTasks == 1)
+		{
+			return {.MaxTasks = 1};
+		}
+
+		return {
+			.MaxTasks = Tasks.NumTasks * ChunksPerTask,
+			.MinElementsPerTask = FMath::Max(Options.MinElementsPerTask / ChunksPerTask, 1),
+		};
+	}
+};
+
+/**
+ * Invokes `Body(ChunkIndex, Begin, End)` for every chunk, potentially in parallel. Chunks are claimed in order, one at a
+ * time, by up to `Tasks.NumTasks` tasks.
+ * Blocks until all chunks have been processed.
+ */
+template <typename BodyType>
+void ParallelForEachClaimedChunk(const FClaimableChunks& Claimable, const BodyType& Body)
+{
+	std::atomic<int32> NextChunk = 0;
+	_IGRP ParallelForEachChunk(Claimable.Tasks, [&Claimable, &Body, &NextChunk](int32, int64, int64) {
+		const FParallelChunks& Chunks = Claimable.Chunks;
+		for (int32 ChunkIndex = NextChunk++; ChunkIndex < Chunks.NumTasks; ChunkIndex = NextChunk++)
+		{
+			Body(ChunkIndex, Chunks.GetBegin(ChunkIndex), Chunks.GetEnd(ChunkIndex));
+		}
+	});
+}
+
+/**
+ * Gets an iterator to the element at the specified index of a random-access range.
+ */
+template <typename IteratorType>
+[[nodiscard]] IteratorType Advanced(const IteratorType& First, int64 Index)
+{
+	return First + static_cast<std::iter_difference_t<IteratorType>>(Index);
+}
+
+/**
+ * Splits a range into chunks & folds each chunk into a partial result in parallel.
+ * `ChunkFold(First, Last)` is invoked once per chunk & must return that chunk's partial result.
+ * Partial results are returned in source order so that they may be combined with a non-commutative operation.
+ */
+template <typename ResultType, typename RangeType, typename ChunkFoldType>
+[[nodiscard]] TArray<ResultType> ParallelFoldChunks(RangeType& Range, const FParallelOptions& Options, const ResultType& InitialValue, const ChunkFoldType& ChunkFold)
+{
+	const FParallelChunks Chunks(std::ranges::ssize(Range), Options);
+
+	TArray<ResultType> Partials;
+	Partials.Init(InitialValue, Chunks.NumTasks);
+
+	const auto First = std::ranges::begin(Range);
+	_IGRP ParallelForEachChunk(Chunks, [&](int32 TaskIndex, int64 Begin, int64 End) {
+		// Each task folds into a local value & only writes its slot once at the end to avoid false sharing.
+		ResultType Partial = ChunkFold(_IGRP Advanced(First, Begin), _IGRP Advanced(First, End));
+		Partials[TaskIndex] = std::move(Partial);
+	});
+
+	return Partials;
+}
+
+} // namespace Private
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
@@ -0,0 +1,290 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "HAL/Platform.h"
+#include "IGRanges/Impl/Common.h"
+#include "Math/Vector.h"
+#include "Math/Vector4.h"
+#include "Math/VectorRegister.h"
+#include "Misc/CoreMiscDefines.h" // `INDEX_NONE`
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges::Private
+{
+template <typename T>
+struct TSumRegister;
+
+template <>
+struct TSumRegister<float>
+{
+	using Type = VectorRegister4Float;
+
+	[[nodiscard]] static Type Zero()
+	{
+		return VectorZeroFloat();
+	}
+};
+
+template <>
+struct TSumRegister<double>
+{
+	using Type = VectorRegister4Double;
+
+	[[nodiscard]] static Type Zero()
+	{
+		return VectorZeroDouble();
+	}
+};
+
+template <typename T>
+inline constexpr bool IsSumScalar = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+/**
+ * Types whose sums are computed with several independent accumulators (& SIMD registers where possible) when the
+ * elements are stored contiguously.
+ */
+template <typename T>
+concept VectorizableSum =
+	std::is_same_v<T, int32> || std::is_same_v<T, uint32> || std::is_same_v<T, int64> || std::is_same_v<T, uint64>
+	|| std::is_same_v<T, float> || std::is_same_v<T, double>
+	|| std::is_same_v<T, UE::Math::TVector<float>> || std::is_same_v<T, UE::Math::TVector<double>>
+	|| std::is_same_v<T, UE::Math::TVector4<float>> || std::is_same_v<T, UE::Math::TVector4<double>>;
+
+/**
+ * Adds groups of 4 scalars into 4 lanes so that `OutLanes[k]` is the sum of every `Data[4 * i + k]`.
+ * Returns the number of scalars consumed (always a multiple of 4); the caller adds the rest.
+ */
+template <typename ScalarType>
+[[nodiscard]] int64 SumLanes(const ScalarType* Data, int64 NumScalars, ScalarType (&OutLanes)[4])
+{
+	using RegisterType = typename TSumRegister<ScalarType>::Type;
+
+	// Several accumulators so that each add doesn't have to wait for the previous one to finish.
+	RegisterType Acc0 = TSumRegister<ScalarType>::Zero();
+	RegisterType Acc1 = TSumRegister<ScalarType>::Zero();
+	RegisterType Acc2 = TSumRegister<ScalarType>::Zero();
+	RegisterType Acc3 = TSumRegister<ScalarType>::Zero();
+
+	int64 i = 0;
+	for (; i + 16 <= NumScalars; i += 16)
+	{
+		Acc0 = VectorAdd(Acc0, VectorLoad(Data + i));
+		Acc1 = VectorAdd(Acc1, VectorLoad(Data + i + 4));
+		Acc2 = VectorAdd(Acc2, VectorLoad(Data + i + 8));
+		Acc3 = VectorAdd(Acc3, VectorLoad(Data + i + 12));
+	}
+
+	for (; i + 4 <= NumScalars; i += 4)
+	{
+		Acc0 = VectorAdd(Acc0, VectorLoad(Data + i));
+	}
+
+	VectorStore(VectorAdd(VectorAdd(Acc0, Acc1), VectorAdd(Acc2, Acc3)), OutLanes);
+	return i;
+}
+
+/**
+ * `FVector` is 3 scalars wide, so 4 vectors fill exactly 3 registers:
+ * [X0 Y0 Z0 X1] [Y1 Z1 X2 Y2] [Z2 X3 Y3 Z3]
+ * Each register accumulates the same components every iteration & the lanes are untangled at the end.
+ */
+template <typename ScalarType>
+[[nodiscard]] UE::Math::TVector<ScalarType> SumVectors(const UE::Math::TVector<ScalarType>* Data, int64 Num)
+{
+	static_assert(sizeof(UE::Math::TVector<ScalarType>) == 3 * sizeof(ScalarType));
+
+	using RegisterType = typename TSumRegister<ScalarType>::Type;
+
+	const ScalarType* Scalars = reinterpret_cast<const ScalarType*>(Data);
+	RegisterType Acc0 = TSumRegister<ScalarType>::Zero();
+	RegisterType Acc1 = TSumRegister<ScalarType>::Zero();
+	RegisterType Acc2 = TSumRegister<ScalarType>::Zero();
+
+	int64 i = 0;
+	for (; i + 4 <= Num; i += 4)
+	{
+		const ScalarType* Block = Scalars + i * 3;
+		Acc0 = VectorAdd(Acc0, VectorLoad(Block));
+		Acc1 = VectorAdd(Acc1, VectorLoad(Block + 4));
+		Acc2 = VectorAdd(Acc2, VectorLoad(Block + 8));
+	}
+
+	ScalarType L0[4];
+	ScalarType L1[4];
+	ScalarType L2[4];
+	VectorStore(Acc0, L0);
+	VectorStore(Acc1, L1);
+	VectorStore(Acc2, L2);
+
+	UE::Math::TVector<ScalarType> Result(
+		(L0[0] + L0[3]) + (L1[2] + L2[1]),
+		(L0[1] + L1[0]) + (L1[3] + L2[2]),
+		(L0[2] + L1[1]) + (L2[0] + L2[3]));
+
+	for (; i < Num; ++i)
+	{
+		Result += Data[i];
+	}
+
+	return Result;
+}
+
+/**
+ * Sums contiguous elements using several independent accumulators (& SIMD registers for floating-point types).
+ * `Num` must be greater than zero.
+ */
+template <_IGRP VectorizableSum T>
+[[nodiscard]] T SumContiguous(const T* Data, int64 Num)
+{
+	if constexpr (_IGRP IsSumScalar<T>)
+	{
+		T Lanes[4];
+		int64 i = _IGRP SumLanes(Data, Num, Lanes);
+
+		T Result = (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+		for (; i < Num; ++i)
+		{
+			Result += Data[i];
+		}
+
+		return Result;
+	}
+	else if constexpr (std::is_same_v<T, UE::Math::TVector4<float>> || std::is_same_v<T, UE::Math::TVector4<double>>)
+	{
+		using ScalarType = typename T::FReal;
+		static_assert(sizeof(T) == 4 * sizeof(ScalarType));
+
+		// Every register holds exactly one vector, so the lanes are the components.
+		ScalarType Lanes[4];
+		(void)_IGRP SumLanes(reinterpret_cast<const ScalarType*>(Data), Num * 4, Lanes);
+		return T(Lanes[0], Lanes[1], Lanes[2], Lanes[3]);
+	}
+	else if constexpr (std::is_same_v<T, UE::Math::TVector<float>> || std::is_same_v<T, UE::Math::TVector<double>>)
+	{
+		return _IGRP SumVectors(Data, Num);
+	}
+	else
+	{
+		// Integers: the compiler is free to vectorize independent accumulators.
+		T Acc[4] = {};
+
+		int64 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			Acc[0] += Data[i];
+			Acc[1] += Data[i + 1];
+			Acc[2] += Data[i + 2];
+			Acc[3] += Data[i + 3];
+		}
+
+		T Result = (Acc[0] + Acc[1]) + (Acc[2] + Acc[3]);
+		for (; i < Num; ++i)
+		{
+			Result += Data[i];
+		}
+
+		return Result;
+	}
+}
+
+/**
+ * Sums a projection of contiguous elements (e.g. `&FBar::Weight`) using several independent accumulators.
+ * The projection is still invoked once per element, in order.
+ * `Num` must be greater than zero.
+ */
+template <typename T, typename ElementType, typename ProjectionType>
+[[nodiscard]] T SumContiguousProjected(ElementType* Data, int64 Num, ProjectionType& Proj)
+{
+	T Acc0 = _IGRP Construct<T>();
+	T Acc1 = _IGRP Construct<T>();
+	T Acc2 = _IGRP Construct<T>();
+	T Acc3 = _IGRP Construct<T>();
+
+	int64 i = 0;
+	for (; i + 4 <= Num; i += 4)
+	{
+		Acc0 += std::invoke(Proj, Data[i]);
+		Acc1 += std::invoke(Proj, Data[i + 1]);
+		Acc2 += std::invoke(Proj, Data[i + 2]);
+		Acc3 += std::invoke(Proj, Data[i + 3]);
+	}
+
+	T Result = (Acc0 + Acc1) + (Acc2 + Acc3);
+	for (; i < Num; ++i)
+	{
+		Result += std::invoke(Proj, Data[i]);
+	}
+
+	return Result;
+}
+
+/**
+ * Element types that are cheap to copy & compare, so contiguous ranges of them are scanned without per-element
+ * branches.
+ */
+template <typename T>
+concept BranchlessElement = std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+/**
+ * Counts the contiguous elements that satisfy a predicate.
+ * The predicate's result is added instead of branched on, so simple comparisons become vector compares (& the sum of
+ * the resulting masks) rather than a mispredicted branch per element.
+ */
+template <typename ElementType, typename PredicateType>
+[[nodiscard]] int64 CountContiguous(ElementType* Data, int64 Num, PredicateType& Pred)
+{
+	int64 Result = 0;
+	for (int64 i = 0; i < Num; ++i)
+	{
+		Result += static_cast<int64>(static_cast<bool>(std::invoke(Pred, Data[i])));
+	}
+
+	return Result;
+}
+
+/**
+ * Finds the index of the first contiguous element that compares equal to `Value`, or `INDEX_NONE`.
+ * Whole blocks are compared without branching (vector compares) & only the block containing a match is searched element
+ * by element.
+ */
+template <typename ElementType, typename ValueType>
+[[nodiscard]] int64 IndexOfContiguous(const ElementType* Data, int64 Num, const ValueType& Value)
+{
+	// Large enough that the compiler keeps the inner loop as a loop (& vectorizes it) rather than fully unrolling it.
+	constexpr int64 BlockSize = 64;
+
+	int64 i = 0;
+	for (; i + BlockSize <= Num; i += BlockSize)
+	{
+		// Counting matches (rather than OR'ing bools) is the form that compilers reliably vectorize.
+		uint32 NumMatches = 0;
+		for (int64 k = 0; k < BlockSize; ++k)
+		{
+			NumMatches += static_cast<uint32>(Data[i + k] == Value);
+		}
+
+		if (NumMatches != 0)
+		{
+			break;
+		}
+	}
+
+	for (; i < Num; ++i)
+	{
+		if (Data[i] == Value)
+		{
+			return i;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+} // namespace IG::Ranges::Private
+
+#include "IGRanges/Impl/Epilogue.inl"
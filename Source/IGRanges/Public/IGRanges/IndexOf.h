@@ -0,0 +1,87 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "HAL/Platform.h" // `int32`
+#include "IGRanges/Impl/Vectorized.h"
+#include "Misc/CoreMiscDefines.h" // `INDEX_NONE`
+#include <ranges>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+struct IndexOf_fn
+{
+	template <typename RangeType, typename ValueType>
+		requires requires(std::ranges::range_reference_t<RangeType> Elem, const ValueType& Value) { static_cast<bool>(Elem == Value); }
+	[[nodiscard]] constexpr int32 operator()(RangeType&& Range, const ValueType& Value) const
+	{
+		if constexpr (std::ranges::contiguous_range<RangeType> && std::ranges::sized_range<RangeType> && _IGRP BranchlessElement<std::ranges::range_value_t<RangeType>>)
+		{
+			return static_cast<int32>(_IGRP IndexOfContiguous(std::ranges::data(Range), static_cast<int64>(std::ranges::size(Range)), Value));
+		}
+		else
+		{
+			int32 Index = 0;
+			for (auto&& X : Range)
+			{
+				if (X == Value)
+				{
+					return Index;
+				}
+
+				++Index;
+			}
+
+			return INDEX_NONE;
+		}
+	}
+};
+
+struct Contains_fn
+{
+	template <typename RangeType, typename ValueType>
+		requires std::invocable<const IndexOf_fn&, RangeType, const ValueType&>
+	[[nodiscard]] constexpr bool operator()(RangeType&& Range, const ValueType& Value) const
+	{
+		return _IGRP IndexOf_fn{}(std::forward<RangeType>(Range), Value) != INDEX_NONE;
+	}
+};
+
+} // namespace Private
+
+/**
+ * Returns the index of the first element in a range that compares equal to a value, or `INDEX_NONE` if there is none.
+ *
+ * Contiguous ranges (e.g. `TArray`) of arithmetic, enum, or pointer values are compared a block at a time without
+ * branching, which lets the comparisons be vectorized.
+ *
+ * @usage
+ * int32 Index = SomeActors | IndexOf(Rosie);
+ * int32 Index = SomeActors | Select(&AActor::GetFName) | IndexOf(FName(TEXT("Rosie")));
+ */
+template <typename ValueType>
+[[nodiscard]] constexpr auto IndexOf(ValueType&& Value)
+{
+	return std::ranges::_Range_closure<_IGRP IndexOf_fn, std::decay_t<ValueType>>{std::forward<ValueType>(Value)};
+}
+
+/**
+ * Returns True if any element in a range compares equal to a value; otherwise, False.
+ * Equivalent to `IndexOf(value) != INDEX_NONE`, so it's vectorized for the same ranges.
+ *
+ * @usage
+ * bool bHasRosie = SomeActors | Contains(Rosie);
+ */
+template <typename ValueType>
+[[nodiscard]] constexpr auto Contains(ValueType&& Value)
+{
+	return std::ranges::_Range_closure<_IGRP Contains_fn, std::decay_t<ValueType>>{std::forward<ValueType>(Value)};
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
@@ -0,0 +1,185 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "Async/Future.h"
+#include "Containers/Array.h"
+#include "Containers/Set.h"
+#include "IGRanges/Impl/Common.h"
+#include "IGRanges/Impl/FilterMapView.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/SoftObjectPtr.h"
+#include "UObject/UObjectGlobals.h"
+#include <ranges>
+#include <type_traits>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+[[nodiscard]] inline FSoftObjectPath ToSoftObjectPath(const FSoftObjectPath& Path)
+{
+	return Path;
+}
+
+template <typename SoftPtrType>
+	requires requires(const SoftPtrType& SoftPtr) { SoftPtr.ToSoftObjectPath(); }
+[[nodiscard]] FSoftObjectPath ToSoftObjectPath(const SoftPtrType& SoftPtr)
+{
+	return SoftPtr.ToSoftObjectPath();
+}
+
+/**
+ * Gets the object that a soft path/pointer refers to if it's already loaded; never loads anything.
+ * `TSoftObjectPtr<T>` yields `T*` & `TSoftClassPtr<T>` yields `UClass*` (same as their `Get` methods).
+ */
+[[nodiscard]] inline UObject* ResolveLoaded(const FSoftObjectPath& Path)
+{
+	return Path.ResolveObject();
+}
+
+template <typename SoftPtrType>
+	requires _IGRP HasGet<const SoftPtrType&>
+[[nodiscard]] auto ResolveLoaded(const SoftPtrType& SoftPtr)
+{
+	return SoftPtr.Get();
+}
+
+template <typename T>
+concept SoftPathLike = requires(const T& X) {
+	_IGRP ToSoftObjectPath(X);
+	_IGRP ResolveLoaded(X);
+};
+
+/**
+ * Requests the packages of several soft object paths at once & calls `OnLoaded` after all of them have finished
+ * loading (successfully or not).
+ * Paths that are null or whose objects are already loaded aren't requested; if nothing needs to be loaded, then
+ * `OnLoaded` is called immediately.
+ */
+inline void LoadPackagesAsync(const TArray<FSoftObjectPath>& Paths, TFunction<void()> OnLoaded)
+{
+	TSet<FName> PackageNames;
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		if (!Path.IsNull() && Path.ResolveObject() == nullptr)
+		{
+			PackageNames.Emplace(Path.GetLongPackageFName());
+		}
+	}
+
+	if (PackageNames.IsEmpty())
+	{
+		OnLoaded();
+		return;
+	}
+
+	// Completion callbacks are called on the game thread, so the count doesn't need to be atomic.
+	TSharedRef<int32> NumPending = MakeShared<int32>(PackageNames.Num());
+	TSharedRef<TFunction<void()>> SharedOnLoaded = MakeShared<TFunction<void()>>(MoveTemp(OnLoaded));
+	for (const FName PackageName : PackageNames)
+	{
+		LoadPackageAsync(PackageName.ToString(), FLoadPackageAsyncDelegate::CreateLambda([NumPending, SharedOnLoaded](const FName&, UPackage*, EAsyncLoadingResult::Type) {
+			if (--*NumPending == 0)
+			{
+				(*SharedOnLoaded)();
+			}
+		}));
+	}
+}
+
+struct LoadAll_fn
+{
+	template <typename RangeType>
+		requires _IGRP SoftPathLike<std::ranges::range_value_t<RangeType>>
+	[[nodiscard]] auto operator()(RangeType&& Range) const
+	{
+		using SoftPtrType = std::ranges::range_value_t<RangeType>;
+		using ObjectPtrType = decltype(_IGRP ResolveLoaded(std::declval<const SoftPtrType&>()));
+
+		TArray<SoftPtrType> SoftPtrs;
+		TArray<FSoftObjectPath> Paths;
+		if constexpr (std::ranges::sized_range<RangeType>)
+		{
+			SoftPtrs.Reserve(static_cast<int32>(std::ranges::size(Range)));
+			Paths.Reserve(static_cast<int32>(std::ranges::size(Range)));
+		}
+
+		for (auto&& X : Range)
+		{
+			Paths.Emplace(_IGRP ToSoftObjectPath(X));
+			SoftPtrs.Emplace(std::forward<decltype(X)>(X));
+		}
+
+		TSharedRef<TPromise<TArray<ObjectPtrType>>> Promise = MakeShared<TPromise<TArray<ObjectPtrType>>>();
+		TFuture<TArray<ObjectPtrType>> Future = Promise->GetFuture();
+
+		_IGRP LoadPackagesAsync(Paths, [SoftPtrs = MoveTemp(SoftPtrs), Promise]() {
+			TArray<ObjectPtrType> Objects;
+			Objects.Reserve(SoftPtrs.Num());
+			for (const SoftPtrType& SoftPtr : SoftPtrs)
+			{
+				if (ObjectPtrType Obj = _IGRP ResolveLoaded(SoftPtr))
+				{
+					Objects.Emplace(Obj);
+				}
+			}
+
+			Promise->SetValue(MoveTemp(Objects));
+		});
+
+		return Future;
+	}
+};
+
+struct LoadedOnly_fn
+{
+	template <typename RangeType>
+		requires _IGRP SoftPathLike<std::ranges::range_value_t<RangeType>>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range) const
+	{
+		return _IGRP TFilterMapView(std::views::all(std::forward<RangeType>(Range)), [](const auto& x) { return _IGRP ResolveLoaded(x); });
+	}
+};
+
+} // namespace Private
+
+/**
+ * Loads the objects of a sequence of soft references (`TSoftObjectPtr<T>`, `TSoftClassPtr<T>`, or `FSoftObjectPath`)
+ * asynchronously & returns a future that's fulfilled (on the game thread) once all of them have been loaded.
+ * The result holds the loaded objects in the order of the range; null references & objects that failed to load are
+ * omitted.
+ *
+ * The whole range is requested at once (each package once, & only if its object isn't loaded yet) instead of loading
+ * each element synchronously. The range is read immediately, so it doesn't need to outlive the request.
+ * The future doesn't keep the objects from being garbage collected; reference them before the next collection.
+ *
+ * @usage
+ * TFuture<TArray<UStaticMesh*>> Meshes = SomeSoftMeshes | LoadAll();
+ * (SomeSoftMeshes | LoadAll()).Then([](TFuture<TArray<UStaticMesh*>> Loaded) { ... });
+ */
+[[nodiscard]] inline constexpr auto LoadAll()
+{
+	return std::ranges::_Range_closure<_IGRP LoadAll_fn>{};
+}
+
+/**
+ * Yields the objects of a sequence of soft references (`TSoftObjectPtr<T>`, `TSoftClassPtr<T>`, or `FSoftObjectPath`)
+ * that are already loaded & skips the rest. Never loads anything.
+ * Each element is resolved exactly once.
+ *
+ * @usage
+ * SomeSoftMeshes | LoadedOnly() | Select(&UStaticMesh::GetBounds)
+ */
+[[nodiscard]] inline constexpr auto LoadedOnly()
+{
+	return std::ranges::_Range_closure<_IGRP LoadedOnly_fn>{};
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
@@ -0,0 +1,283 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "Misc/Optional.h"
+#include <compare>
+#include <concepts>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+/**
+ * View whose iterators compute the current element of another view the first time that it's dereferenced & keep it
+ * until the iterator moves. Elements are yielded by value (copies of the kept element), which keeps the iterator
+ * category of the underlying view (up to random access) instead of turning it into a "stashing" iterator.
+ */
+template <std::ranges::input_range ViewType>
+	requires std::ranges::view<ViewType>
+class TMemoizeView : public std::ranges::view_interface<TMemoizeView<ViewType>>
+{
+	template <bool bConst>
+	class TIterator
+	{
+		using BaseType = std::conditional_t<bConst, const ViewType, ViewType>;
+		using BaseIteratorType = std::ranges::iterator_t<BaseType>;
+
+		friend TMemoizeView;
+
+	public:
+		using value_type = std::remove_cvref_t<std::ranges::range_reference_t<BaseType>>;
+		using reference = value_type;
+		using difference_type = std::ranges::range_difference_t<BaseType>;
+		using iterator_concept = std::conditional_t<std::ranges::random_access_range<BaseType>, std::random_access_iterator_tag,
+			std::conditional_t<std::ranges::bidirectional_range<BaseType>, std::bidirectional_iterator_tag,
+				std::conditional_t<std::ranges::forward_range<BaseType>, std::forward_iterator_tag, std::input_iterator_tag>>>;
+		using iterator_category = std::input_iterator_tag;
+
+		TIterator() = default;
+
+		[[nodiscard]] reference operator*() const
+		{
+			if (!Cache.IsSet())
+			{
+				Cache.Emplace(*Current);
+			}
+
+			return *Cache;
+		}
+
+		[[nodiscard]] reference operator[](difference_type N) const
+			requires std::ranges::random_access_range<BaseType>
+		{
+			return Current[N];
+		}
+
+		TIterator& operator++()
+		{
+			++Current;
+			Cache.Reset();
+			return *this;
+		}
+
+		void operator++(int)
+		{
+			++*this;
+		}
+
+		TIterator operator++(int)
+			requires std::ranges::forward_range<BaseType>
+		{
+			TIterator Tmp = *this;
+			++*this;
+			return Tmp;
+		}
+
+		TIterator& operator--()
+			requires std::ranges::bidirectional_range<BaseType>
+		{
+			--Current;
+			Cache.Reset();
+			return *this;
+		}
+
+		TIterator operator--(int)
+			requires std::ranges::bidirectional_range<BaseType>
+		{
+			TIterator Tmp = *this;
+			--*this;
+			return Tmp;
+		}
+
+		TIterator& operator+=(difference_type N)
+			requires std::ranges::random_access_range<BaseType>
+		{
+			Current += N;
+			Cache.Reset();
+			return *this;
+		}
+
+		TIterator& operator-=(difference_type N)
+			requires std::ranges::random_access_range<BaseType>
+		{
+			Current -= N;
+			Cache.Reset();
+			return *this;
+		}
+
+		[[nodiscard]] friend TIterator operator+(TIterator It, difference_type N)
+			requires std::ranges::random_access_range<BaseType>
+		{
+			return It += N;
+		}
+
+		[[nodiscard]] friend TIterator operator+(difference_type N, TIterator It)
+			requires std::ranges::random_access_range<BaseType>
+		{
+			return It += N;
+		}
+
+		[[nodiscard]] friend TIterator operator-(TIterator It, difference_type N)
+			requires std::ranges::random_access_range<BaseType>
+		{
+			return It -= N;
+		}
+
+		[[nodiscard]] friend difference_type operator-(const TIterator& Lhs, const TIterator& Rhs)
+			requires std::sized_sentinel_for<BaseIteratorType, BaseIteratorType>
+		{
+			return Lhs.Current - Rhs.Current;
+		}
+
+		[[nodiscard]] friend bool operator==(const TIterator& Lhs, const TIterator& Rhs)
+			requires std::equality_comparable<BaseIteratorType>
+		{
+			return Lhs.Current == Rhs.Current;
+		}
+
+		[[nodiscard]] friend auto operator<=>(const TIterator& Lhs, const TIterator& Rhs)
+			requires std::ranges::random_access_range<BaseType> && std::three_way_comparable<BaseIteratorType>
+		{
+			return Lhs.Current <=> Rhs.Current;
+		}
+
+		[[nodiscard]] friend bool operator==(const TIterator& Lhs, const std::ranges::sentinel_t<BaseType>& Rhs)
+			requires(!std::ranges::common_range<BaseType>)
+		{
+			return Lhs.Current == Rhs;
+		}
+
+	private:
+		explicit TIterator(BaseIteratorType InCurrent)
+			: Current(std::move(InCurrent))
+		{
+		}
+
+		BaseIteratorType Current = BaseIteratorType();
+		mutable TOptional<value_type> Cache;
+	};
+
+public:
+	TMemoizeView()
+		requires std::default_initializable<ViewType>
+	= default;
+
+	explicit TMemoizeView(ViewType InBase)
+		: Base(std::move(InBase))
+	{
+	}
+
+	[[nodiscard]] ViewType base() const&
+		requires std::copy_constructible<ViewType>
+	{
+		return Base;
+	}
+
+	[[nodiscard]] ViewType base() &&
+	{
+		return std::move(Base);
+	}
+
+	[[nodiscard]] TIterator<false> begin()
+	{
+		return TIterator<false>(std::ranges::begin(Base));
+	}
+
+	[[nodiscard]] TIterator<true> begin() const
+		requires std::ranges::input_range<const ViewType>
+	{
+		return TIterator<true>(std::ranges::begin(Base));
+	}
+
+	[[nodiscard]] auto end()
+	{
+		if constexpr (std::ranges::common_range<ViewType>)
+		{
+			return TIterator<false>(std::ranges::end(Base));
+		}
+		else
+		{
+			return std::ranges::end(Base);
+		}
+	}
+
+	[[nodiscard]] auto end() const
+		requires std::ranges::input_range<const ViewType>
+	{
+		if constexpr (std::ranges::common_range<const ViewType>)
+		{
+			return TIterator<true>(std::ranges::end(Base));
+		}
+		else
+		{
+			return std::ranges::end(Base);
+		}
+	}
+
+	[[nodiscard]] auto size()
+		requires std::ranges::sized_range<ViewType>
+	{
+		return std::ranges::size(Base);
+	}
+
+	[[nodiscard]] auto size() const
+		requires std::ranges::sized_range<const ViewType>
+	{
+		return std::ranges::size(Base);
+	}
+
+private:
+	ViewType Base;
+};
+
+template <typename RangeType>
+TMemoizeView(RangeType&&) -> TMemoizeView<std::views::all_t<RangeType>>;
+
+struct Memoize_fn
+{
+	template <std::ranges::viewable_range RangeType>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range) const
+	{
+		// Elements that are references already refer to something that outlives the iterator; there's nothing to keep.
+		if constexpr (std::is_reference_v<std::ranges::range_reference_t<RangeType>>)
+		{
+			return std::views::all(std::forward<RangeType>(Range));
+		}
+		else
+		{
+			return _IGRP TMemoizeView(std::forward<RangeType>(Range));
+		}
+	}
+};
+
+} // namespace Private
+
+/**
+ * Computes each element of a sequence at most once per iterator position, no matter how many times it's dereferenced.
+ * Useful after an expensive `Select` that's followed by a `Where`, which would otherwise invoke the projection once for
+ * the predicate & again when the consumer reads the element.
+ *
+ * Elements are yielded by value (copies of the element that was computed), so this is best suited to projections that
+ * are expensive to compute but cheap to copy. Ranges whose elements are references are passed through unchanged.
+ * Forward, bidirectional, random access, common & sized ranges remain so.
+ *
+ * @usage
+ * SomeActors
+ *     | Select([](const AActor* A) { return A->GetComponentByClass<UMyComponent>(); })
+ *     | Memoize()
+ *     | Where([](const UMyComponent* C) { return C != nullptr && C->IsActive(); })
+ */
+[[nodiscard]] inline constexpr auto Memoize()
+{
+	return std::ranges::_Range_closure<_IGRP Memoize_fn>{};
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
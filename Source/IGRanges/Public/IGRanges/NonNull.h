@@ -2,8 +2,10 @@
 
 #pragma once
 
+#include "IGRanges/Impl/FilterMapView.h"
 #include "Templates/SharedPointer.h"
 #include <ranges>
+#include <type_traits>
 
 #include "IGRanges/Impl/Prologue.inl"
 
@@ -11,18 +13,49 @@ namespace IG::Ranges
 {
 namespace Private
 {
+/**
+ * A `TSharedPtr` that was pinned from a `TWeakPtr`, which `TFilterMapView` keeps in its iterator while it yields a
+ * reference to the object.
+ */
+template <typename SharedPtrType>
+struct TPinned
+{
+	SharedPtrType Ptr;
+};
+
+template <typename SharedPtrType>
+struct TFilterMapResult<TPinned<SharedPtrType>>
+{
+	using ValueType = std::remove_cv_t<typename SharedPtrType::ElementType>;
+	using ReferenceType = typename SharedPtrType::ElementType&;
+
+	// The pin is released along with the iterator.
+	static constexpr bool bStashing = true;
+
+	[[nodiscard]] static bool IsSome(const TPinned<SharedPtrType>& Result)
+	{
+		return Result.Ptr.IsValid();
+	}
+
+	[[nodiscard]] static ReferenceType Unwrap(const TPinned<SharedPtrType>& Result)
+	{
+		return *Result.Ptr;
+	}
+};
+
 struct NonNullRef_fn
 {
-	template <typename RangeType>
+	template <std::ranges::viewable_range RangeType>
 	[[nodiscard]] constexpr auto operator()(RangeType&& Range) const
 	{
 		using T = std::ranges::range_value_t<RangeType>;
 
 		if constexpr (TIsTWeakPtr_V<T>) // Support for `TWeakPtr`
 		{
-			return std::forward<RangeType>(Range)
-				 | std::views::filter([](auto&& x) { return x.IsValid(); })
-				 | std::views::transform([](auto&& x) -> T::ElementType& { return *x.Pin().Get(); });
+			// Pin each element once & keep it pinned while the iterator refers to it.
+			return _IGRP TFilterMapView(std::views::all(std::forward<RangeType>(Range)), [](auto&& x) {
+				return _IGRP TPinned<decltype(x.Pin())>{x.Pin()};
+			});
 		}
 		else
 		{
@@ -56,6 +89,8 @@ struct NonNullRef_fn
 
 /**
  * Same as `NonNull` but yields references to values instead of pointers.
+ * Weak pointers (`TWeakPtr`) are pinned once per element & stay pinned while an iterator refers to the element, so the
+ * object stays alive while the reference is being used.
  */
 [[nodiscard]] inline constexpr auto NonNullRef()
 {
@@ -3,6 +3,9 @@
 #pragma once
 
 #include "IGRanges/Cast.h"
+#include "IGRanges/Impl/ChildOfAnyCache.h"
+#include "IGRanges/Impl/Common.h"
+#include "IGRanges/Impl/FilterMapView.h"
 #include "UObject/SoftObjectPtr.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 #include <ranges>
@@ -41,17 +44,31 @@ template <typename T>
 	return std::views::transform([](auto&& x) -> decltype(*x)& { return *x; });
 }
 
-[[nodiscard]] inline constexpr auto NonNull()
+template <class T, bool bExact>
+struct OfType_fn
 {
-	return std::views::filter([](const void* x) { return x != nullptr; });
-}
+	template <std::ranges::viewable_range RangeType>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range) const
+	{
+		using PointerType = std::remove_cvref_t<std::ranges::range_reference_t<RangeType>>;
+		if constexpr (bExact)
+		{
+			return _IGRP TFilterMapView(std::views::all(std::forward<RangeType>(Range)), [](auto&& x) { return ::ExactCast<T>(x); });
+		}
+		else
+		{
+			return _IGRP TFilterMapView(std::views::all(std::forward<RangeType>(Range)), _IGRP MakeCaster<T, PointerType>());
+		}
+	}
+};
 
 } // namespace Private
 
 /**
  * Filters the values of a range of UObjects based on a specified type.
  * Performs a cast to the specified type and then filters null elements.
- * Equivalent to `Cast<T>() | NonNull()`.
+ * Equivalent to `Cast<T>() | NonNull()`, except that each element is only cast once (the filter & the consumer of the
+ * range share the result).
  *
  * All the "Of Type" range adapters are safe to accept null values and never yield null results.
  *
@@ -62,7 +79,7 @@ template <typename T>
 template <class T>
 [[nodiscard]] constexpr auto OfType()
 {
-	return _IGR Cast<T>() | _IGRP NonNull();
+	return std::ranges::_Range_closure<_IGRP OfType_fn<T, false>>{};
 }
 
 /**
@@ -71,7 +88,7 @@ template <class T>
 template <class T>
 [[nodiscard]] constexpr auto OfTypeRef()
 {
-	return _IGR Cast<T>() | _IGRP NonNull() | _IGRP Dereference();
+	return _IGR OfType<T>() | _IGRP Dereference();
 }
 
 /**
@@ -80,7 +97,7 @@ template <class T>
 template <class T>
 [[nodiscard]] constexpr auto OfExactType()
 {
-	return _IGR ExactCast<T>() | _IGRP NonNull();
+	return std::ranges::_Range_closure<_IGRP OfType_fn<T, true>>{};
 }
 
 /**
@@ -89,15 +106,25 @@ template <class T>
 template <class T>
 [[nodiscard]] constexpr auto OfExactTypeRef()
 {
-	return _IGR ExactCast<T>() | _IGRP NonNull() | _IGRP Dereference();
+	return _IGR OfExactType<T>() | _IGRP Dereference();
 }
 
 /**
  * Similar to `OfType<T>` (checks types) but does not perform a cast.
+ * Like `Cast<T>`, runs of raw pointers to objects with the same class only check the class hierarchy once.
  */
 [[nodiscard]] inline constexpr auto OfType(const UClass* Class)
 {
-	return std::views::filter([Class](auto&& x) { return _IGRP IsA(x, Class); });
+	return std::views::filter([Class, Cache = _IGRP FClassMatchCache(Class)](auto&& x) {
+		if constexpr (std::is_pointer_v<std::remove_cvref_t<decltype(x)>>)
+		{
+			return Cache.IsA(x);
+		}
+		else
+		{
+			return _IGRP IsA(x, Class);
+		}
+	});
 }
 
 /**
@@ -108,6 +135,33 @@ template <class T>
 	return _IGR OfType(Class) | _IGRP Dereference();
 }
 
+/**
+ * Filters the values of a range of UObjects, keeping the ones that are any of the specified types.
+ * Does not perform a cast (the element type is unchanged).
+ * Each distinct class is checked against the types once & the result is remembered, so later objects with the same class
+ * take constant time regardless of the number of types.
+ *
+ * @usage
+ * SomeComponents | OfAnyType<UStaticMeshComponent, USkeletalMeshComponent>()
+ */
+template <class... Ts>
+[[nodiscard]] auto OfAnyType()
+{
+	return std::views::filter([Cache = _IGRP FChildOfAnyCache({Ts::StaticClass()...})](auto&& x) {
+		const UObject* Obj = nullptr;
+		if constexpr (_IGRP HasGet<decltype(x)>)
+		{
+			Obj = x.Get();
+		}
+		else
+		{
+			Obj = x;
+		}
+
+		return Obj != nullptr && Cache.IsChildOfAny(Obj->GetClass());
+	});
+}
+
 } // namespace IG::Ranges
 
 #include "IGRanges/Impl/Epilogue.inl"
@@ -0,0 +1,327 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "HAL/Platform.h" // `int32`
+#include "IGRanges/Impl/FilterMapView.h"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+/**
+ * Compares two keys, returning a negative number if `A` comes first, a positive number if `B` comes first, or zero if
+ * they're equivalent. Only `operator<` is required.
+ */
+template <bool bDescending, typename KeyType>
+[[nodiscard]] constexpr int32 CompareKeys(const KeyType& A, const KeyType& B)
+{
+	if (A < B)
+	{
+		return bDescending ? 1 : -1;
+	}
+
+	if (B < A)
+	{
+		return bDescending ? -1 : 1;
+	}
+
+	return 0;
+}
+
+/** Secondary ordering of an `OrderBy` that hasn't been followed by `ThenBy`: everything is equivalent. */
+struct FNoThenBy
+{
+	template <typename ValueType>
+	[[nodiscard]] constexpr int32 Compare(const ValueType&, const ValueType&) const
+	{
+		return 0;
+	}
+};
+
+/** Secondary ordering of an `OrderBy` followed by one or more `ThenBy`. Keys are only computed to break ties. */
+template <typename PrevThenByType, typename KeySelectorType, bool bDescending>
+struct TThenBy
+{
+	template <typename ValueType>
+	[[nodiscard]] constexpr int32 Compare(const ValueType& A, const ValueType& B) const
+	{
+		if (const int32 Result = Prev.Compare(A, B))
+		{
+			return Result;
+		}
+
+		return _IGRP CompareKeys<bDescending>(std::invoke(*KeySelector, A), std::invoke(*KeySelector, B));
+	}
+
+	PrevThenByType Prev;
+	TMovableBox<KeySelectorType> KeySelector;
+};
+
+/**
+ * View that yields the elements of another view ordered by key.
+ *
+ * The elements (along with their primary keys, which are computed once per element) are copied into a heap the first
+ * time the view is iterated & each step pops the next element, so reading the first K of N elements costs O(N + K log N)
+ * instead of sorting everything. Reading every element amounts to a heapsort.
+ * Elements with equivalent keys keep their order in the underlying view.
+ */
+template <std::ranges::input_range ViewType, typename KeySelectorType, bool bDescending, typename ThenByType>
+	requires std::ranges::view<ViewType> && std::is_object_v<KeySelectorType>
+class TOrderByView : public std::ranges::view_interface<TOrderByView<ViewType, KeySelectorType, bDescending, ThenByType>>
+{
+	using ValueType = std::ranges::range_value_t<ViewType>;
+	using KeyType = std::remove_cvref_t<std::invoke_result_t<KeySelectorType&, std::ranges::range_reference_t<ViewType>>>;
+
+	struct FEntry
+	{
+		KeyType Key;
+		int32 Index;
+		ValueType Value;
+	};
+
+	class FIterator
+	{
+	public:
+		using value_type = ValueType;
+		using difference_type = std::ptrdiff_t;
+		using iterator_concept = std::input_iterator_tag;
+
+		FIterator() = default;
+
+		explicit FIterator(TOrderByView& InParent)
+			: Parent(&InParent)
+		{
+		}
+
+		[[nodiscard]] ValueType& operator*() const
+		{
+			return Parent->Entries[Parent->NumInHeap].Value;
+		}
+
+		FIterator& operator++()
+		{
+			Parent->PopNext();
+			return *this;
+		}
+
+		void operator++(int)
+		{
+			++*this;
+		}
+
+		[[nodiscard]] friend bool operator==(const FIterator& Lhs, std::default_sentinel_t)
+		{
+			return Lhs.IsAtEnd();
+		}
+
+	private:
+		[[nodiscard]] bool IsAtEnd() const
+		{
+			return !Parent->bHasCurrent;
+		}
+
+		TOrderByView* Parent = nullptr;
+	};
+
+public:
+	TOrderByView()
+		requires std::default_initializable<ViewType> && std::default_initializable<KeySelectorType> && std::default_initializable<ThenByType>
+	= default;
+
+	TOrderByView(ViewType InBase, KeySelectorType InKeySelector, ThenByType InThenBy = {})
+		: Base(std::move(InBase))
+		, KeySelector(std::move(InKeySelector))
+		, ThenBy(std::move(InThenBy))
+	{
+	}
+
+	[[nodiscard]] ViewType base() const&
+		requires std::copy_constructible<ViewType>
+	{
+		return Base;
+	}
+
+	[[nodiscard]] ViewType base() &&
+	{
+		return std::move(Base);
+	}
+
+	[[nodiscard]] FIterator begin()
+	{
+		Entries.Reset();
+		if constexpr (std::ranges::sized_range<ViewType>)
+		{
+			Entries.Reserve(static_cast<int32>(std::ranges::size(Base)));
+		}
+
+		for (auto&& X : Base)
+		{
+			KeyType Key = std::invoke(*KeySelector, X);
+			Entries.Add(FEntry{std::move(Key), Entries.Num(), ValueType(std::forward<decltype(X)>(X))});
+		}
+
+		NumInHeap = Entries.Num();
+		std::make_heap(Entries.GetData(), Entries.GetData() + NumInHeap, MakeHeapPredicate());
+
+		PopNext();
+		return FIterator(*this);
+	}
+
+	[[nodiscard]] std::default_sentinel_t end() const
+	{
+		return std::default_sentinel;
+	}
+
+	[[nodiscard]] auto size() const
+		requires std::ranges::sized_range<const ViewType>
+	{
+		return std::ranges::size(Base);
+	}
+
+	/** Returns a copy of this view with another key to break ties with (see `ThenBy`). */
+	template <bool bThenByDescending, typename ThenByKeySelectorType>
+	[[nodiscard]] auto WithThenBy(ThenByKeySelectorType&& ThenByKeySelector) &&
+	{
+		using NewThenByType = TThenBy<ThenByType, std::decay_t<ThenByKeySelectorType>, bThenByDescending>;
+		return TOrderByView<ViewType, KeySelectorType, bDescending, NewThenByType>(
+			std::move(Base),
+			std::move(*KeySelector),
+			NewThenByType{std::move(ThenBy), TMovableBox<std::decay_t<ThenByKeySelectorType>>(std::forward<ThenByKeySelectorType>(ThenByKeySelector))});
+	}
+
+private:
+	/** Returns a predicate that puts the entry that comes first at the top of a (max) heap. */
+	[[nodiscard]] auto MakeHeapPredicate() const
+	{
+		return [this](const FEntry& A, const FEntry& B) {
+			int32 Result = _IGRP CompareKeys<bDescending>(A.Key, B.Key);
+			if (Result == 0)
+			{
+				Result = ThenBy.Compare(A.Value, B.Value);
+			}
+
+			return Result != 0 ? Result > 0 : A.Index > B.Index;
+		};
+	}
+
+	/** Moves the next element out of the heap to just past its end. */
+	void PopNext()
+	{
+		bHasCurrent = NumInHeap > 0;
+		if (bHasCurrent)
+		{
+			std::pop_heap(Entries.GetData(), Entries.GetData() + NumInHeap, MakeHeapPredicate());
+			--NumInHeap;
+		}
+	}
+
+	ViewType Base;
+	TMovableBox<KeySelectorType> KeySelector;
+	ThenByType ThenBy;
+	TArray<FEntry> Entries;
+	int32 NumInHeap = 0;
+	bool bHasCurrent = false;
+};
+
+template <typename T>
+inline constexpr bool TIsOrderByView_V = false;
+
+template <typename ViewType, typename KeySelectorType, bool bDescending, typename ThenByType>
+inline constexpr bool TIsOrderByView_V<TOrderByView<ViewType, KeySelectorType, bDescending, ThenByType>> = true;
+
+template <bool bDescending>
+struct OrderBy_fn
+{
+	template <typename RangeType, typename KeySelectorType>
+		requires std::invocable<std::decay_t<KeySelectorType>&, std::ranges::range_reference_t<RangeType>>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range, KeySelectorType&& KeySelector) const
+	{
+		using ViewType = std::views::all_t<RangeType>;
+		return _IGRP TOrderByView<ViewType, std::decay_t<KeySelectorType>, bDescending, _IGRP FNoThenBy>(
+			std::views::all(std::forward<RangeType>(Range)),
+			std::forward<KeySelectorType>(KeySelector));
+	}
+};
+
+template <bool bDescending>
+struct ThenBy_fn
+{
+	template <typename OrderedType, typename KeySelectorType>
+		requires _IGRP TIsOrderByView_V<std::remove_cvref_t<OrderedType>>
+	[[nodiscard]] constexpr auto operator()(OrderedType&& Ordered, KeySelectorType&& KeySelector) const
+	{
+		return std::remove_cvref_t<OrderedType>(std::forward<OrderedType>(Ordered)).template WithThenBy<bDescending>(std::forward<KeySelectorType>(KeySelector));
+	}
+};
+
+} // namespace Private
+
+/**
+ * Sorts the elements of a sequence in ascending order of the keys produced by a key selector (compared with
+ * `operator<`). Elements with equivalent keys keep their original order.
+ *
+ * Evaluated lazily with a heap: nothing happens until the result is iterated, & pipelines that only read the first few
+ * elements (e.g. `OrderBy(key) | FirstOrDefault()`) don't pay for sorting the rest. Each key is computed once per
+ * element. The elements are copied into the view when it's iterated; iterating it again starts over.
+ *
+ * @usage
+ * AActor* Nearest = SomeActors | OrderBy([&](const AActor* A) { return FVector::DistSquared(A->GetActorLocation(), Origin); }) | FirstOrDefault();
+ * TArray<FBar> Sorted = SomeStructs | OrderBy(&FBar::Priority) | ToArray();
+ */
+template <typename KeySelectorType>
+[[nodiscard]] constexpr auto OrderBy(KeySelectorType&& KeySelector)
+{
+	return std::ranges::_Range_closure<_IGRP OrderBy_fn<false>, std::decay_t<KeySelectorType>>{std::forward<KeySelectorType>(KeySelector)};
+}
+
+/**
+ * Same as `OrderBy` but in descending order of the keys.
+ *
+ * @usage
+ * TArray<FBar> Sorted = SomeStructs | OrderByDescending(&FBar::Priority) | ToArray();
+ */
+template <typename KeySelectorType>
+[[nodiscard]] constexpr auto OrderByDescending(KeySelectorType&& KeySelector)
+{
+	return std::ranges::_Range_closure<_IGRP OrderBy_fn<true>, std::decay_t<KeySelectorType>>{std::forward<KeySelectorType>(KeySelector)};
+}
+
+/**
+ * Orders the elements that have equivalent keys in an `OrderBy` (or `OrderByDescending`) by another key, in ascending
+ * order. Must immediately follow `OrderBy`, `OrderByDescending`, `ThenBy`, or `ThenByDescending`.
+ * These keys are only computed to break ties.
+ *
+ * @usage
+ * SomeStructs | OrderBy(&FBar::Priority) | ThenBy(&FBar::Name) | ToArray()
+ */
+template <typename KeySelectorType>
+[[nodiscard]] constexpr auto ThenBy(KeySelectorType&& KeySelector)
+{
+	return std::ranges::_Range_closure<_IGRP ThenBy_fn<false>, std::decay_t<KeySelectorType>>{std::forward<KeySelectorType>(KeySelector)};
+}
+
+/**
+ * Same as `ThenBy` but in descending order of the keys.
+ *
+ * @usage
+ * SomeStructs | OrderBy(&FBar::Priority) | ThenByDescending(&FBar::Weight) | ToArray()
+ */
+template <typename KeySelectorType>
+[[nodiscard]] constexpr auto ThenByDescending(KeySelectorType&& KeySelector)
+{
+	return std::ranges::_Range_closure<_IGRP ThenBy_fn<true>, std::decay_t<KeySelectorType>>{std::forward<KeySelectorType>(KeySelector)};
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
@@ -0,0 +1,185 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "IGRanges/Impl/Common.h"
+#include "IGRanges/Impl/Parallel.h"
+#include <functional>
+#include <ranges>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+struct ParallelAccumulate_fn
+{
+	template <typename RangeType, typename SeedType, typename FoldType, typename CombineType>
+	[[nodiscard]] auto operator()(RangeType&& Range, const SeedType& Seed, const FoldType& Fold, const CombineType& Combine, const FParallelOptions& Options) const
+	{
+		static_assert(_IGRP ParallelizableRange<RangeType>, "`ParallelAccumulate` requires a sized random-access range.");
+
+		TArray<SeedType> Partials = _IGRP ParallelFoldChunks(Range, Options, Seed, [&Seed, &Fold](auto It, const auto Last) {
+			SeedType Acc = Seed;
+			for (; It != Last; ++It)
+			{
+				Acc = std::invoke(Fold, std::move(Acc), *It);
+			}
+
+			return Acc;
+		});
+
+		SeedType Result = std::move(Partials[0]);
+		for (int32 i = 1; i < Partials.Num(); ++i)
+		{
+			Result = std::invoke(Combine, std::move(Result), std::move(Partials[i]));
+		}
+
+		return Result;
+	}
+};
+
+struct ParallelSum_fn
+{
+	template <typename RangeType>
+	[[nodiscard]] auto operator()(RangeType&& Range, const FParallelOptions& Options) const
+	{
+		static_assert(_IGRP ParallelizableRange<RangeType>, "`ParallelSum` requires a sized random-access range.");
+
+		using T = std::ranges::range_value_t<RangeType>;
+
+		// If the range is empty, then return a default-initialized value.
+		if (std::ranges::empty(Range))
+		{
+			return _IGRP Construct<T>();
+		}
+
+		// Chunks are never empty, so each one is summed starting from its first element (same as `Sum`).
+		TArray<T> Partials = _IGRP ParallelFoldChunks(Range, Options, _IGRP Construct<T>(), [](auto It, const auto Last) {
+			T Acc = *It;
+			while (++It != Last)
+			{
+				Acc = std::move(Acc) + *It;
+			}
+
+			return Acc;
+		});
+
+		T Result = std::move(Partials[0]);
+		for (int32 i = 1; i < Partials.Num(); ++i)
+		{
+			Result = std::move(Result) + std::move(Partials[i]);
+		}
+
+		return Result;
+	}
+};
+
+struct ParallelCount_fn
+{
+	template <typename RangeType, class _Pr>
+	[[nodiscard]] int32 operator()(RangeType&& Range, const _Pr& _Pred, const FParallelOptions& Options) const
+	{
+		static_assert(_IGRP ParallelizableRange<RangeType>, "`ParallelCount` requires a sized random-access range.");
+
+		const TArray<int32> Partials = _IGRP ParallelFoldChunks(Range, Options, 0, [&_Pred](auto It, const auto Last) {
+			int32 Count = 0;
+			for (; It != Last; ++It)
+			{
+				Count += std::invoke(_Pred, *It) ? 1 : 0;
+			}
+
+			return Count;
+		});
+
+		int32 Result = 0;
+		for (const int32 Partial : Partials)
+		{
+			Result += Partial;
+		}
+
+		return Result;
+	}
+};
+
+} // namespace Private
+
+/**
+ * Same as `Accumulate` but splits the range into chunks that are folded in parallel on the task graph.
+ * Each chunk is folded into its own accumulator (starting from the seed value) & the partial results are then merged,
+ * in source order, with `Combine(acc, partial)`.
+ *
+ * Requirements:
+ * - The range must be sized & random-access (e.g. `TArray`, `TArrayView`, or `Select` applied to one of those).
+ * - The seed value must be an identity for `Combine` (e.g. zero for addition) because it seeds every chunk.
+ * - `Combine` must be associative (it does not need to be commutative).
+ * - `Fold` & `Combine` are invoked concurrently from multiple threads, so they must not modify shared state.
+ *
+ * @usage
+ * uint64 TotalLength = SomeObjects | ParallelAccumulate(uint64{}, [](uint64 Acc, const UObject* Obj) {
+ *     return Acc + GetNameSafe(Obj).Len();
+ * }, std::plus<>());
+ */
+template <typename T, typename FoldType, typename CombineType>
+[[nodiscard]] constexpr auto ParallelAccumulate(T&& Seed, FoldType&& Fold, CombineType&& Combine, const FParallelOptions& Options = {})
+{
+	return std::ranges::_Range_closure<
+		_IGRP ParallelAccumulate_fn,
+		std::decay_t<T>,
+		std::decay_t<FoldType>,
+		std::decay_t<CombineType>,
+		FParallelOptions> //
+		{
+			std::forward<T>(Seed),
+			std::forward<FoldType>(Fold),
+			std::forward<CombineType>(Combine),
+			FParallelOptions(Options),
+		};
+}
+
+/**
+ * Same as `Sum` but splits the range into chunks that are summed in parallel on the task graph.
+ * The range must be sized & random-access (e.g. `TArray`, `TArrayView`, or `Select` applied to one of those).
+ *
+ * @usage
+ * int64 Total = SomeNumbers | ParallelSum();
+ */
+[[nodiscard]] inline constexpr auto ParallelSum(const FParallelOptions& Options = {})
+{
+	return std::ranges::_Range_closure<_IGRP ParallelSum_fn, FParallelOptions>{FParallelOptions(Options)};
+}
+
+/**
+ * Same as `ParallelSum` (no parameters) but first applies a projection to elements.
+ * The projection is invoked concurrently from multiple threads, so it must not modify shared state.
+ * Equivalent to `Select(proj) | ParallelSum()`.
+ *
+ * @usage
+ * float TotalWeight = SomeStructs | ParallelSum(&FBar::Weight);
+ */
+template <typename TransformT>
+	requires(!std::is_same_v<std::decay_t<TransformT>, FParallelOptions>)
+[[nodiscard]] constexpr auto ParallelSum(TransformT&& Trans, const FParallelOptions& Options = {})
+{
+	return std::views::transform(std::forward<TransformT>(Trans))
+		 | _IGR ParallelSum(Options);
+}
+
+/**
+ * Same as `Count(pred)` but splits the range into chunks that are counted in parallel on the task graph.
+ * The range must be sized & random-access (e.g. `TArray`, `TArrayView`, or `Select` applied to one of those).
+ * The predicate is invoked concurrently from multiple threads, so it must not modify shared state.
+ *
+ * @usage
+ * int32 NumVulerableActors = SomeActors | ParallelCount(&AActor::CanBeDamaged);
+ */
+template <class _Pr>
+[[nodiscard]] constexpr auto ParallelCount(_Pr&& _Pred, const FParallelOptions& Options = {})
+{
+	return std::ranges::_Range_closure<_IGRP ParallelCount_fn, std::decay_t<_Pr>, FParallelOptions>{std::forward<_Pr>(_Pred), FParallelOptions(Options)};
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
@@ -0,0 +1,230 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "IGRanges/AllAnyNone.h"
+#include "IGRanges/Impl/Common.h"
+#include "IGRanges/Impl/Parallel.h"
+#include "Templates/SharedPointer.h"
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+enum class EParallelSearch
+{
+	// Any match decides the answer.
+	AnyMatch,
+	// Only the match with the lowest index decides the answer.
+	LowestMatch,
+};
+
+/**
+ * Searches the chunks of a range for an element that satisfies a predicate in parallel.
+ * Returns the index of a matching element, or `INDEX_NONE` if there isn't one. When searching for the lowest match,
+ * the result is always the lowest index that matches, no matter how the chunks were scheduled.
+ *
+ * Tasks publish the index of their first match through an atomic & every task stops once it can no longer find a
+ * better one (i.e. as soon as anything matches, or only once a match has been found at a lower index).
+ */
+template <EParallelSearch _Search, typename RangeType, class _Pr>
+[[nodiscard]] int64 ParallelFindIndex(RangeType& Range, const _Pr& _Pred, const FParallelOptions& Options)
+{
+	constexpr int64 NotFound = std::numeric_limits<int64>::max();
+
+	const FParallelChunks Chunks(std::ranges::ssize(Range), Options);
+	std::atomic<int64> FoundIndex = NotFound;
+
+	const auto First = std::ranges::begin(Range);
+	_IGRP ParallelForEachChunk(Chunks, [&](int32 TaskIndex, int64 Begin, int64 End) {
+		auto It = _IGRP Advanced(First, Begin);
+		for (int64 Index = Begin; Index < End; ++Index, ++It)
+		{
+			const int64 Found = FoundIndex.load(std::memory_order_relaxed);
+			if (_Search == EParallelSearch::AnyMatch ? (Found != NotFound) : (Found < Index))
+			{
+				return;
+			}
+
+			if (std::invoke(_Pred, *It))
+			{
+				// Keep the lowest index if another task published a match at the same time.
+				int64 Expected = FoundIndex.load(std::memory_order_relaxed);
+				while (Index < Expected && !FoundIndex.compare_exchange_weak(Expected, Index, std::memory_order_relaxed))
+				{
+				}
+
+				return;
+			}
+		}
+	});
+
+	const int64 Result = FoundIndex.load(std::memory_order_relaxed);
+	return (Result == NotFound) ? INDEX_NONE : Result;
+}
+
+template <EAlgoChoice _Choice>
+struct ParallelAlgo_fn
+{
+	template <typename RangeType, class _Pr>
+	[[nodiscard]] bool operator()(RangeType&& Range, const _Pr& _Pred, const FParallelOptions& Options) const
+	{
+		static_assert(_IGRP ParallelizableRange<RangeType>, "`ParallelAll`, `ParallelAny`, & `ParallelNone` require a sized random-access range.");
+
+		if constexpr (_Choice == EAlgoChoice::AllOf)
+		{
+			return _IGRP ParallelFindIndex<EParallelSearch::AnyMatch>(Range, std::not_fn(_Pred), Options) == INDEX_NONE;
+		}
+		else if constexpr (_Choice == EAlgoChoice::AnyOf)
+		{
+			return _IGRP ParallelFindIndex<EParallelSearch::AnyMatch>(Range, _Pred, Options) != INDEX_NONE;
+		}
+		else if constexpr (_Choice == EAlgoChoice::NoneOf)
+		{
+			return _IGRP ParallelFindIndex<EParallelSearch::AnyMatch>(Range, _Pred, Options) == INDEX_NONE;
+		}
+	}
+};
+
+struct ParallelFirstOrDefault_fn
+{
+	template <typename RangeType, class _Pr>
+	[[nodiscard]] auto operator()(RangeType&& Range, const _Pr& _Pred, const FParallelOptions& Options) const
+	{
+		static_assert(_IGRP ParallelizableRange<RangeType>, "`ParallelFirstOrDefault` requires a sized random-access range.");
+
+		using T = std::ranges::range_value_t<RangeType>;
+
+		static_assert(!TIsTSharedRef_V<T>, "`ParallelFirstOrDefault` cannot operate on ranges of `TSharedRef`.");
+
+		const int64 Index = _IGRP ParallelFindIndex<EParallelSearch::LowestMatch>(Range, _Pred, Options);
+		if (Index == INDEX_NONE)
+		{
+			return _IGRP Construct<T>();
+		}
+
+		return T(*_IGRP Advanced(std::ranges::begin(Range), Index));
+	}
+};
+
+} // namespace Private
+
+/**
+ * Same as `All` but splits the range into chunks that are tested in parallel on the task graph.
+ * As soon as any task finds an element that doesn't satisfy the predicate, the other tasks stop testing elements.
+ * The range must be sized & random-access (e.g. `TArray`, `TArrayView`, or `Select` applied to one of those).
+ * The predicate is invoked concurrently from multiple threads, so it must not modify shared state.
+ *
+ * @usage
+ * bool bAllVisible = SomeActors | ParallelAll([&](const AActor* A) { return HasLineOfSight(Viewer, A); });
+ */
+template <class _Pr = std::identity>
+	requires(!std::is_same_v<std::decay_t<_Pr>, FParallelOptions>)
+[[nodiscard]] constexpr auto ParallelAll(_Pr&& _Pred = {}, const FParallelOptions& Options = {})
+{
+	return std::ranges::_Range_closure<_IGRP ParallelAlgo_fn<_IGRP EAlgoChoice::AllOf>, std::decay_t<_Pr>, FParallelOptions>{std::forward<_Pr>(_Pred), FParallelOptions(Options)};
+}
+
+/**
+ * Same as `ParallelAll` (no parameters) but takes options that control how the range is split into tasks.
+ *
+ * @usage
+ * bool bAllSet = SomeFlags | ParallelAll({.MinElementsPerTask = 1024});
+ */
+[[nodiscard]] inline constexpr auto ParallelAll(const FParallelOptions& Options)
+{
+	return _IGR ParallelAll(std::identity(), Options);
+}
+
+/**
+ * Same as `Any` but splits the range into chunks that are tested in parallel on the task graph.
+ * As soon as any task finds an element that satisfies the predicate, the other tasks stop testing elements.
+ * The range must be sized & random-access (e.g. `TArray`, `TArrayView`, or `Select` applied to one of those).
+ * The predicate is invoked concurrently from multiple threads, so it must not modify shared state.
+ *
+ * @usage
+ * bool bAnyVisible = SomeActors | ParallelAny([&](const AActor* A) { return HasLineOfSight(Viewer, A); });
+ */
+template <class _Pr = _IGRP AlwaysTrue>
+	requires(!std::is_same_v<std::decay_t<_Pr>, FParallelOptions>)
+[[nodiscard]] constexpr auto ParallelAny(_Pr&& _Pred = {}, const FParallelOptions& Options = {})
+{
+	return std::ranges::_Range_closure<_IGRP ParallelAlgo_fn<_IGRP EAlgoChoice::AnyOf>, std::decay_t<_Pr>, FParallelOptions>{std::forward<_Pr>(_Pred), FParallelOptions(Options)};
+}
+
+/**
+ * Same as `ParallelAny` (no parameters) but takes options that control how the range is split into tasks.
+ *
+ * @usage
+ * bool bAnySet = SomeFlags | ParallelAny({.MaxTasks = 4});
+ */
+[[nodiscard]] inline constexpr auto ParallelAny(const FParallelOptions& Options)
+{
+	return _IGR ParallelAny(_IGRP AlwaysTrue(), Options);
+}
+
+/**
+ * Same as `None` but splits the range into chunks that are tested in parallel on the task graph.
+ * As soon as any task finds an element that satisfies the predicate, the other tasks stop testing elements.
+ * The range must be sized & random-access (e.g. `TArray`, `TArrayView`, or `Select` applied to one of those).
+ * The predicate is invoked concurrently from multiple threads, so it must not modify shared state.
+ *
+ * @usage
+ * bool bNoneVisible = SomeActors | ParallelNone([&](const AActor* A) { return HasLineOfSight(Viewer, A); });
+ */
+template <class _Pr = std::identity>
+	requires(!std::is_same_v<std::decay_t<_Pr>, FParallelOptions>)
+[[nodiscard]] constexpr auto ParallelNone(_Pr&& _Pred = {}, const FParallelOptions& Options = {})
+{
+	return std::ranges::_Range_closure<_IGRP ParallelAlgo_fn<_IGRP EAlgoChoice::NoneOf>, std::decay_t<_Pr>, FParallelOptions>{std::forward<_Pr>(_Pred), FParallelOptions(Options)};
+}
+
+/**
+ * Same as `ParallelNone` (no parameters) but takes options that control how the range is split into tasks.
+ *
+ * @usage
+ * bool bNoneSet = SomeFlags | ParallelNone({.MinElementsPerTask = 1024});
+ */
+[[nodiscard]] inline constexpr auto ParallelNone(const FParallelOptions& Options)
+{
+	return _IGR ParallelNone(std::identity(), Options);
+}
+
+/**
+ * Same as `FirstOrDefault` but splits the range into chunks that are tested in parallel on the task graph.
+ * Always returns the first matching element in the order of the range (never whichever one happened to be found first).
+ * Tasks stop testing elements once a match has been found before their position.
+ * The range must be sized & random-access (e.g. `TArray`, `TArrayView`, or `Select` applied to one of those).
+ * The predicate is invoked concurrently from multiple threads, so it must not modify shared state.
+ *
+ * @usage
+ * AActor* FirstVisible = SomeActors | ParallelFirstOrDefault([&](const AActor* A) { return HasLineOfSight(Viewer, A); });
+ */
+template <class _Pr = _IGRP AlwaysTrue>
+	requires(!std::is_same_v<std::decay_t<_Pr>, FParallelOptions>)
+[[nodiscard]] constexpr auto ParallelFirstOrDefault(_Pr&& _Pred = {}, const FParallelOptions& Options = {})
+{
+	return std::ranges::_Range_closure<_IGRP ParallelFirstOrDefault_fn, std::decay_t<_Pr>, FParallelOptions>{std::forward<_Pr>(_Pred), FParallelOptions(Options)};
+}
+
+/**
+ * Same as `ParallelFirstOrDefault` (no parameters) but takes options that control how the range is split into tasks.
+ *
+ * @usage
+ * AActor* First = SomeActors | ParallelFirstOrDefault({.MaxTasks = 4});
+ */
+[[nodiscard]] inline constexpr auto ParallelFirstOrDefault(const FParallelOptions& Options)
+{
+	return _IGR ParallelFirstOrDefault(_IGRP AlwaysTrue(), Options);
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
@@ -0,0 +1,127 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "IGRanges/AppendTo.h"
+#include "IGRanges/Impl/Parallel.h"
+#include "IGRanges/Reserve.h"
+#include "Templates/MemoryOps.h"
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+/**
+ * Moves the elements of several arrays into one array (in the same order), which is allocated once. Each array is
+ * moved by its own task.
+ */
+template <typename ArrayType>
+[[nodiscard]] ArrayType ConcatenateInParallel(TArray<ArrayType>& Buffers)
+{
+	using T = typename ArrayType::ElementType;
+
+	if (Buffers.Num() == 1)
+	{
+		return MoveTemp(Buffers[0]);
+	}
+
+	// The offset of each buffer in the result is the total number of elements in the buffers before it.
+	TArray<int32> Offsets;
+	Offsets.SetNumUninitialized(Buffers.Num());
+
+	int32 Num = 0;
+	for (int32 BufferIndex = 0; BufferIndex < Buffers.Num(); ++BufferIndex)
+	{
+		Offsets[BufferIndex] = Num;
+		Num += Buffers[BufferIndex].Num();
+	}
+
+	ArrayType Result;
+	Result.SetNumUninitialized(Num);
+
+	T* const ResultData = Result.GetData();
+	ParallelFor(
+		Buffers.Num(),
+		[&](int32 BufferIndex) {
+			ArrayType& Buffer = Buffers[BufferIndex];
+			MoveConstructItems<T>(ResultData + Offsets[BufferIndex], Buffer.GetData(), Buffer.Num());
+		},
+		EParallelForFlags::Unbalanced);
+
+	return Result;
+}
+
+struct ParallelToArray_fn
+{
+	template <typename RangeType, typename PipelineType>
+	[[nodiscard]] auto operator()(RangeType&& Range, const PipelineType& Pipeline, const FParallelOptions& Options) const
+	{
+		static_assert(_IGRP ParallelizableRange<RangeType>, "`ParallelToArray` requires a sized random-access range.");
+
+		using ChunkType = std::ranges::subrange<std::ranges::iterator_t<RangeType>>;
+		using T = std::ranges::range_value_t<decltype(std::declval<ChunkType>() | Pipeline)>;
+
+		const FParallelChunks Chunks(std::ranges::ssize(Range), Options);
+
+		// Each task applies the pipeline to its own chunk of the source & collects the results in its own buffer.
+		TArray<TArray<T>> Buffers;
+		Buffers.SetNum(Chunks.NumTasks);
+
+		const auto First = std::ranges::begin(Range);
+		_IGRP ParallelForEachChunk(Chunks, [&](int32 TaskIndex, int64 Begin, int64 End) {
+			// Filled locally & only moved into its slot at the end to avoid false sharing.
+			TArray<T> Buffer;
+			_IGRP AppendTo_fn{}(ChunkType(_IGRP Advanced(First, Begin), _IGRP Advanced(First, End)) | Pipeline, &Buffer, _IGRP FReserveIfSized());
+			Buffers[TaskIndex] = MoveTemp(Buffer);
+		});
+
+		return _IGRP ConcatenateInParallel(Buffers);
+	}
+};
+
+} // namespace Private
+
+/**
+ * Same as `ToArray` but splits the range into chunks that are converted in parallel on the task graph.
+ * The range must be sized & random-access (e.g. `TArray`, `TArrayView`, or `Select` applied to one of those).
+ * Elements are in the same order as `ToArray`.
+ *
+ * @usage
+ * TArray<FName> Names = SomeObjects | Select(&UObject::GetFName) | ParallelToArray();
+ */
+[[nodiscard]] inline constexpr auto ParallelToArray(const FParallelOptions& Options = {})
+{
+	return std::ranges::_Range_closure<_IGRP ParallelToArray_fn, std::remove_cvref_t<decltype(std::views::all)>, FParallelOptions>{std::views::all, FParallelOptions(Options)};
+}
+
+/**
+ * Same as `ParallelToArray` (no parameters) but first applies a pipeline of adaptors (e.g. `OfType`, `Where`, &
+ * `Select`) to each chunk of the range. Chunks are filtered into separate buffers in parallel, which are then
+ * compacted (also in parallel) into one array that's allocated once.
+ * The result is the same as `pipeline | ToArray()`, in the same order.
+ *
+ * Filters usually make ranges unsized & not random-access, so they're passed as a pipeline instead of being applied
+ * before `ParallelToArray`. The pipeline is invoked concurrently from multiple threads, so it must not modify shared
+ * state.
+ *
+ * @usage
+ * TArray<FVector> Locations = SomeActors | ParallelToArray(OfType<APawn>() | Where(&APawn::IsPlayerControlled) | Select(&APawn::GetActorLocation));
+ */
+template <typename PipelineType>
+	requires(!std::is_same_v<std::decay_t<PipelineType>, FParallelOptions>)
+[[nodiscard]] constexpr auto ParallelToArray(PipelineType&& Pipeline, const FParallelOptions& Options = {})
+{
+	return std::ranges::_Range_closure<_IGRP ParallelToArray_fn, std::decay_t<PipelineType>, FParallelOptions>{
+		std::forward<PipelineType>(Pipeline),
+		FParallelOptions(Options)};
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
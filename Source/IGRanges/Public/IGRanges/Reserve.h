@@ -0,0 +1,234 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "HAL/Platform.h"
+#include "Math/UnrealMathUtility.h"
+#include <atomic>
+#include <concepts>
+#include <ranges>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+/**
+ * Remembers the fraction of elements that survive a filtering pipeline so that later materializations of the same
+ * query can reserve (approximately) the right amount of space up front.
+ * Intended to be declared `static` at the call site & used with `ReservePredicted`.
+ * Safe to share between threads.
+ */
+struct FSelectivityEstimate
+{
+	/**
+	 * Gets the estimated fraction (0..1) of elements that survive, or a negative value if nothing has been observed yet.
+	 */
+	[[nodiscard]] float Get() const
+	{
+		return Selectivity.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Records that `Num` elements survived out of (at most) `Bound` input elements.
+	 */
+	void Observe(int64 Bound, int64 Num)
+	{
+		if (Bound <= 0)
+		{
+			return;
+		}
+
+		const float Observed = FMath::Clamp(static_cast<float>(Num) / static_cast<float>(Bound), 0.0f, 1.0f);
+		const float Previous = Get();
+
+		// The first observation is taken as-is, later ones are blended in so that one unusual frame doesn't throw off
+		// the estimate too much.
+		Selectivity.store((Previous < 0.0f) ? Observed : (Previous + (Observed - Previous) * 0.25f), std::memory_order_relaxed);
+	}
+
+private:
+	std::atomic<float> Selectivity = -1.0f;
+};
+
+namespace Private
+{
+template <typename ViewType>
+inline constexpr bool IsBoundedByBase = false;
+
+// `Where` never yields more elements than its base.
+template <typename ViewType, typename PredicateType>
+inline constexpr bool IsBoundedByBase<std::ranges::filter_view<ViewType, PredicateType>> = true;
+
+// `Select` yields exactly as many elements as its base.
+template <typename ViewType, typename FunctionType>
+inline constexpr bool IsBoundedByBase<std::ranges::transform_view<ViewType, FunctionType>> = true;
+
+// `std::views::take_while` never yields more elements than its base.
+template <typename ViewType, typename PredicateType>
+inline constexpr bool IsBoundedByBase<std::ranges::take_while_view<ViewType, PredicateType>> = true;
+
+// `std::views::drop_while` never yields more elements than its base.
+template <typename ViewType, typename PredicateType>
+inline constexpr bool IsBoundedByBase<std::ranges::drop_while_view<ViewType, PredicateType>> = true;
+
+/**
+ * Gets an upper bound for the number of elements in a range without iterating it, or -1 if no bound is known.
+ * Sized ranges report their size. Views that never yield more elements than their base (e.g. `Where`, `Select`) report
+ * the bound of their base & `Take` reports the smaller of its count & the bound of its base.
+ */
+template <typename RangeType>
+[[nodiscard]] int64 GetSizeBound(RangeType&& Range)
+{
+	using ViewType = std::remove_cvref_t<RangeType>;
+
+	if constexpr (std::ranges::sized_range<RangeType>)
+	{
+		return static_cast<int64>(std::ranges::distance(Range));
+	}
+	else if constexpr (_IGRP IsBoundedByBase<ViewType> && requires { Range.base(); })
+	{
+		return _IGRP GetSizeBound(Range.base());
+	}
+	else if constexpr (requires { Range.base(); { Range.count() } -> std::integral; })
+	{
+		// `Take` never yields more elements than its count or its base.
+		const int64 BaseBound = _IGRP GetSizeBound(Range.base());
+		const int64 Count = static_cast<int64>(Range.count());
+		return BaseBound < 0 ? Count : FMath::Min(BaseBound, Count);
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+/**
+ * Base type for objects that tell `ToArray` & `ToSet` how much space to reserve before adding elements.
+ */
+struct FReservePolicy
+{
+	// Called after the container has been filled.
+	template <typename RangeType>
+	void Observe(RangeType&&, int64) const
+	{
+	}
+};
+
+template <typename T>
+concept ReservePolicy = std::derived_from<std::decay_t<T>, _IGRP FReservePolicy>;
+
+/**
+ * Reserves space only when the size of the range is known up front.
+ * This is the default policy.
+ */
+struct FReserveIfSized : _IGRP FReservePolicy
+{
+	template <typename RangeType>
+	[[nodiscard]] int64 GetReserveCount(RangeType&& Range) const
+	{
+		if constexpr (std::ranges::sized_range<RangeType>)
+		{
+			return static_cast<int64>(std::ranges::distance(Range));
+		}
+		else
+		{
+			return 0;
+		}
+	}
+};
+
+struct FReserveExact : _IGRP FReservePolicy
+{
+	template <typename RangeType>
+	[[nodiscard]] int64 GetReserveCount(RangeType&& Range) const
+	{
+		if constexpr (std::ranges::sized_range<RangeType> || std::ranges::forward_range<RangeType>)
+		{
+			// For unsized ranges, this walks the whole range (without dereferencing the final projections).
+			return static_cast<int64>(std::ranges::distance(Range));
+		}
+		else
+		{
+			return 0;
+		}
+	}
+};
+
+struct FReserveUpperBound : _IGRP FReservePolicy
+{
+	template <typename RangeType>
+	[[nodiscard]] int64 GetReserveCount(RangeType&& Range) const
+	{
+		return FMath::Max<int64>(_IGRP GetSizeBound(Range), 0);
+	}
+};
+
+struct FReservePredicted : _IGRP FReservePolicy
+{
+	template <typename RangeType>
+	[[nodiscard]] int64 GetReserveCount(RangeType&& Range) const
+	{
+		const int64 Bound = _IGRP GetSizeBound(Range);
+		const float Selectivity = Estimate->Get();
+		if (Bound <= 0 || Selectivity < 0.0f)
+		{
+			return 0;
+		}
+
+		// Leave a little slack so that small fluctuations don't cause a reallocation.
+		const int64 Predicted = static_cast<int64>(FMath::CeilToDouble(static_cast<double>(Bound) * Selectivity * 1.125));
+		return FMath::Min(Predicted, Bound);
+	}
+
+	template <typename RangeType>
+	void Observe(RangeType&& Range, int64 Num) const
+	{
+		Estimate->Observe(_IGRP GetSizeBound(Range), Num);
+	}
+
+	FSelectivityEstimate* Estimate = nullptr;
+};
+
+} // namespace Private
+
+/**
+ * Reservation policy for `ToArray` & `ToSet`.
+ * Counts the elements of the range before adding them so that exactly the right amount of space is reserved.
+ * Unsized ranges (e.g. ones that use `Where`) are walked twice, so this is intended for pipelines whose filters are
+ * cheap & have no side effects. Projections applied after the last filter are not invoked by the counting pass.
+ *
+ * @usage
+ * TArray<UFoo*> Foos = SomeObjects | OfType<UFoo>() | ToArray(ReserveExact);
+ */
+inline constexpr _IGRP FReserveExact ReserveExact{};
+
+/**
+ * Reservation policy for `ToArray` & `ToSet`.
+ * Reserves enough space for every element of the nearest sized upstream range (e.g. the source array of a `Where`).
+ * Never reallocates when a bound is known, but may over-allocate for selective filters.
+ *
+ * @usage
+ * TArray<UFoo*> Foos = SomeObjects | OfType<UFoo>() | ToArray(ReserveUpperBound);
+ */
+inline constexpr _IGRP FReserveUpperBound ReserveUpperBound{};
+
+/**
+ * Reservation policy for `ToArray` & `ToSet`.
+ * Reserves space for the expected number of elements based on the nearest sized upstream range & the fraction of
+ * elements that survived previous materializations (as recorded in the estimate).
+ * The first materialization only learns the selectivity & does not reserve.
+ *
+ * @usage
+ * static FSelectivityEstimate FooSelectivity;
+ * TArray<UFoo*> Foos = SomeObjects | OfType<UFoo>() | ToArray(ReservePredicted(FooSelectivity));
+ */
+[[nodiscard]] inline _IGRP FReservePredicted ReservePredicted(FSelectivityEstimate& Estimate)
+{
+	_IGRP FReservePredicted Policy;
+	Policy.Estimate = &Estimate;
+	return Policy;
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
@@ -0,0 +1,46 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "IGRanges/Impl/Common.h"
+#include "IGRanges/Impl/FilterMapView.h"
+#include <ranges>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+struct ResolveWeak_fn
+{
+	template <typename RangeType>
+		requires _IGRP HasGet<std::ranges::range_reference_t<RangeType>>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range) const
+	{
+		return _IGRP TFilterMapView(std::views::all(std::forward<RangeType>(Range)), [](auto&& x) { return x.Get(); });
+	}
+};
+
+} // namespace Private
+
+/**
+ * Resolves a sequence of weak object pointers (e.g. `TWeakObjectPtr<T>`, or any object pointer with a `Get` method like
+ * `TSoftObjectPtr<T>`) into raw pointers, removing the ones that are stale (or null).
+ *
+ * Each element is resolved exactly once. Null checks, `Get`, `Cast` & `IsA` on weak object pointers each look up the
+ * object again, so resolving first lets the rest of the range adapters work on raw pointers. In particular, `Cast<T>`,
+ * `OfType<T>` & `OfType(Class)` only check the class hierarchy once for runs of raw pointers to objects of the same class.
+ *
+ * @usage
+ * SomeWeakActors | ResolveWeak() | OfType<AMyActor>()
+ * SomeWeakActors | ResolveWeak() | SafeWhere(&AActor::IsHidden)
+ */
+[[nodiscard]] inline constexpr auto ResolveWeak()
+{
+	return std::ranges::_Range_closure<_IGRP ResolveWeak_fn>{};
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
@@ -2,7 +2,7 @@
 
 #pragma once
 
-#include "IGRanges/NonNull.h"
+#include "IGRanges/FilterMap.h"
 #include <ranges>
 
 #include "IGRanges/Impl/Prologue.inl"
@@ -30,7 +30,7 @@ template <class _Fn>
 /**
  * Same as `Select` but intended for projections that produce pointer-like results.
  * Projection results that are Null are filtered out.
- * Equivalent to `Select(proj) | NonNull()`.
+ * Equivalent to `Select(proj) | NonNull()`, except that the projection is invoked once per element (see `FilterMap`).
  *
  * @usage:
  * SomeActors | SelectNonNull([](const AActor* A) {
@@ -40,7 +40,7 @@ template <class _Fn>
 template <class _Fn>
 [[nodiscard]] constexpr auto SelectNonNull(_Fn&& _Fun)
 {
-	return std::views::transform(std::forward<_Fn>(_Fun)) | _IGR NonNull();
+	return _IGR FilterMap(std::forward<_Fn>(_Fun));
 }
 
 } // namespace IG::Ranges
@@ -0,0 +1,49 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "HAL/Platform.h" // `int32`
+#include "Math/UnrealMathUtility.h"
+#include <ranges>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+/**
+ * Skips the first `Count` elements of a sequence & returns the rest.
+ * Sized random access sequences (e.g. `TArray`) skip in constant time.
+ *
+ * Alias for `std::views::drop`:
+ * A range adaptor consisting of elements of the underlying sequence, skipping the first N elements.
+ *
+ * @usage
+ * SomeActors | Skip(1)
+ * SomeNumbers | Where([](int32 N) { return N > 0; }) | Skip(3)
+ */
+[[nodiscard]] inline constexpr auto Skip(int32 Count)
+{
+	return std::views::drop(FMath::Max(Count, 0));
+}
+
+/**
+ * Skips the elements of a sequence as long as they satisfy a predicate & returns the rest, starting at the first
+ * element that doesn't.
+ *
+ * Alias for `std::views::drop_while`:
+ * A range adaptor that represents view of the elements of an underlying sequence, beginning at the first element for
+ * which the predicate returns false.
+ *
+ * @usage
+ * SomeNumbers | SkipWhile([](int32 N) { return N < 0; })
+ * SomeStructs | SkipWhile(&FBar::IsGood)
+ */
+template <class _Pr>
+[[nodiscard]] constexpr auto SkipWhile(_Pr&& _Pred)
+{
+	return std::views::drop_while(std::forward<_Pr>(_Pred));
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
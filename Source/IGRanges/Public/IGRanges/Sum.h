@@ -3,6 +3,8 @@
 #pragma once
 
 #include "IGRanges/Impl/Common.h"
+#include "IGRanges/Impl/Vectorized.h"
+#include <functional>
 #include <ranges>
 
 #include "IGRanges/Impl/Prologue.inl"
@@ -14,12 +16,19 @@ namespace Private
 struct Sum_fn
 {
 	template <typename RangeType>
+		requires std::ranges::input_range<RangeType>
 	[[nodiscard]] constexpr auto operator()(RangeType&& Range) const
 	{
 		using T = std::ranges::range_value_t<RangeType>;
 
-		auto It = std::begin(Range);
-		const auto& End = std::end(Range);
+		if constexpr (std::ranges::contiguous_range<RangeType> && std::ranges::sized_range<RangeType> && _IGRP VectorizableSum<T>)
+		{
+			const int64 Num = static_cast<int64>(std::ranges::size(Range));
+			return (Num > 0) ? _IGRP SumContiguous<T>(std::ranges::data(Range), Num) : _IGRP Construct<T>();
+		}
+
+		auto It = std::ranges::begin(Range);
+		const auto& End = std::ranges::end(Range);
 
 		// If the range is empty, then return a default-initialized value.
 		if (It == End)
@@ -38,12 +47,36 @@ struct Sum_fn
 	}
 };
 
+struct SumBy_fn
+{
+	template <typename RangeType, typename TransformT>
+		requires std::ranges::input_range<RangeType> && std::invocable<TransformT&, std::ranges::range_reference_t<RangeType>>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range, TransformT&& Trans) const
+	{
+		if constexpr (std::ranges::contiguous_range<RangeType> && std::ranges::sized_range<RangeType>)
+		{
+			using T = std::remove_cvref_t<std::invoke_result_t<TransformT&, std::ranges::range_reference_t<RangeType>>>;
+			if constexpr (_IGRP VectorizableSum<T>)
+			{
+				const int64 Num = static_cast<int64>(std::ranges::size(Range));
+				return (Num > 0) ? _IGRP SumContiguousProjected<T>(std::ranges::data(Range), Num, Trans) : _IGRP Construct<T>();
+			}
+		}
+
+		return _IGRP Sum_fn{}(std::views::transform(std::forward<RangeType>(Range), std::forward<TransformT>(Trans)));
+	}
+};
+
 } // namespace Private
 
 /**
  * Computes the sum of a sequence of values by applying `operator+`.
  * Empty ranges return a default-initialized value.
  *
+ * Contiguous ranges (e.g. `TArray`) of integers, floats, doubles, `FVector`, or `FVector4` are summed with several
+ * independent accumulators & SIMD registers. Floating-point results may therefore differ in the last few bits from adding
+ * elements one at a time.
+ *
  * @usage
  * int32 Total = SomeNumbers | Sum();
  * FVector Offset = SomeVectors | Sum();
@@ -56,7 +89,8 @@ struct Sum_fn
 
 /**
  * Same as `Sum` (no parameters) but first applies a projection to elements.
- * Equivalent to `Select(proj) | Sum()`.
+ * Equivalent to `Select(proj) | Sum()`, except that projections of contiguous ranges that yield the types listed above
+ * are summed with several independent accumulators.
  *
  * @usage
  * float TotalWeight = SomeStructs | Sum([](const FBar& B) { return B.Weight; });
@@ -65,8 +99,7 @@ struct Sum_fn
 template <typename TransformT>
 [[nodiscard]] constexpr auto Sum(TransformT&& Trans)
 {
-	return std::views::transform(std::forward<TransformT>(Trans))
-		 | _IGR Sum();
+	return std::ranges::_Range_closure<_IGRP SumBy_fn, std::decay_t<TransformT>>{std::forward<TransformT>(Trans)};
 }
 
 } // namespace IG::Ranges
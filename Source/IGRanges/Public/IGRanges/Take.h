@@ -0,0 +1,247 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "HAL/Platform.h" // `int32`
+#include "Math/UnrealMathUtility.h"
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+/**
+ * View that yields (at most) the first `Count` elements of another view.
+ *
+ * Unlike `std::views::take`, its iterators don't advance the underlying iterator past the last element that's taken,
+ * so filtering views (e.g. `Where`, `OfType`) upstream aren't asked to search for an element that will never be read.
+ */
+template <std::ranges::input_range ViewType>
+	requires std::ranges::view<ViewType>
+class TTakeView : public std::ranges::view_interface<TTakeView<ViewType>>
+{
+	template <bool bConst>
+	class TSentinel;
+
+	template <bool bConst>
+	class TIterator
+	{
+		using BaseType = std::conditional_t<bConst, const ViewType, ViewType>;
+		using BaseIteratorType = std::ranges::iterator_t<BaseType>;
+
+		friend TTakeView;
+		friend TSentinel<bConst>;
+
+	public:
+		using value_type = std::ranges::range_value_t<BaseType>;
+		using difference_type = std::ranges::range_difference_t<BaseType>;
+		using iterator_concept = std::conditional_t<std::ranges::forward_range<BaseType>, std::forward_iterator_tag, std::input_iterator_tag>;
+
+		TIterator() = default;
+
+		[[nodiscard]] decltype(auto) operator*() const
+		{
+			return *Current;
+		}
+
+		TIterator& operator++()
+		{
+			// The underlying iterator stays on the last element that's taken.
+			if (--Remaining > 0)
+			{
+				++Current;
+			}
+
+			return *this;
+		}
+
+		void operator++(int)
+		{
+			++*this;
+		}
+
+		TIterator operator++(int)
+			requires std::ranges::forward_range<BaseType>
+		{
+			TIterator Tmp = *this;
+			++*this;
+			return Tmp;
+		}
+
+		[[nodiscard]] friend bool operator==(const TIterator& Lhs, const TIterator& Rhs)
+			requires std::ranges::forward_range<BaseType>
+		{
+			return Lhs.Remaining == Rhs.Remaining;
+		}
+
+	private:
+		TIterator(BaseIteratorType InCurrent, difference_type InRemaining)
+			: Current(std::move(InCurrent))
+			, Remaining(InRemaining)
+		{
+		}
+
+		BaseIteratorType Current = BaseIteratorType();
+		difference_type Remaining = 0;
+	};
+
+	template <bool bConst>
+	class TSentinel
+	{
+		using BaseType = std::conditional_t<bConst, const ViewType, ViewType>;
+
+		friend TTakeView;
+
+	public:
+		TSentinel() = default;
+
+		[[nodiscard]] friend bool operator==(const TIterator<bConst>& Lhs, const TSentinel& Rhs)
+		{
+			return Rhs.IsAtEnd(Lhs);
+		}
+
+	private:
+		[[nodiscard]] bool IsAtEnd(const TIterator<bConst>& It) const
+		{
+			return It.Remaining <= 0 || It.Current == End;
+		}
+
+		explicit TSentinel(std::ranges::sentinel_t<BaseType> InEnd)
+			: End(std::move(InEnd))
+		{
+		}
+
+		std::ranges::sentinel_t<BaseType> End = std::ranges::sentinel_t<BaseType>();
+	};
+
+public:
+	TTakeView()
+		requires std::default_initializable<ViewType>
+	= default;
+
+	TTakeView(ViewType InBase, std::ranges::range_difference_t<ViewType> InCount)
+		: Base(std::move(InBase))
+		, Count(InCount)
+	{
+	}
+
+	[[nodiscard]] ViewType base() const&
+		requires std::copy_constructible<ViewType>
+	{
+		return Base;
+	}
+
+	[[nodiscard]] ViewType base() &&
+	{
+		return std::move(Base);
+	}
+
+	/** Gets the most elements that this view yields. */
+	[[nodiscard]] auto count() const
+	{
+		return Count;
+	}
+
+	[[nodiscard]] TIterator<false> begin()
+	{
+		return TIterator<false>(std::ranges::begin(Base), Count);
+	}
+
+	[[nodiscard]] TIterator<true> begin() const
+		requires std::ranges::input_range<const ViewType>
+	{
+		return TIterator<true>(std::ranges::begin(Base), Count);
+	}
+
+	[[nodiscard]] TSentinel<false> end()
+	{
+		return TSentinel<false>(std::ranges::end(Base));
+	}
+
+	[[nodiscard]] TSentinel<true> end() const
+		requires std::ranges::input_range<const ViewType>
+	{
+		return TSentinel<true>(std::ranges::end(Base));
+	}
+
+	[[nodiscard]] auto size()
+		requires std::ranges::sized_range<ViewType>
+	{
+		return std::min<std::ranges::range_size_t<ViewType>>(std::ranges::size(Base), static_cast<std::ranges::range_size_t<ViewType>>(Count));
+	}
+
+	[[nodiscard]] auto size() const
+		requires std::ranges::sized_range<const ViewType>
+	{
+		return std::min<std::ranges::range_size_t<const ViewType>>(std::ranges::size(Base), static_cast<std::ranges::range_size_t<const ViewType>>(Count));
+	}
+
+private:
+	ViewType Base;
+	std::ranges::range_difference_t<ViewType> Count = 0;
+};
+
+template <typename RangeType>
+TTakeView(RangeType&&, std::ranges::range_difference_t<RangeType>) -> TTakeView<std::views::all_t<RangeType>>;
+
+struct Take_fn
+{
+	template <std::ranges::viewable_range RangeType>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range, int32 Count) const
+	{
+		const std::ranges::range_difference_t<RangeType> ClampedCount = FMath::Max(Count, 0);
+
+		// Sized random access ranges are sliced without iterating anything, so `std::views::take` is already optimal.
+		if constexpr (std::ranges::random_access_range<RangeType> && std::ranges::sized_range<RangeType>)
+		{
+			return std::views::take(std::forward<RangeType>(Range), ClampedCount);
+		}
+		else
+		{
+			return _IGRP TTakeView(std::views::all(std::forward<RangeType>(Range)), ClampedCount);
+		}
+	}
+};
+
+} // namespace Private
+
+/**
+ * Returns (at most) the first `Count` elements of a sequence.
+ *
+ * Stops pulling from the sequence as soon as `Count` elements have been read, so filters upstream (e.g. `Where`,
+ * `OfType`) aren't invoked for the elements after them. The result is sized if the sequence is, so `ToArray` reserves
+ * exactly the right amount of space.
+ *
+ * @usage
+ * TArray<AActor*> FirstThreeTargets = SomeActors | Where(&AActor::CanBeDamaged) | Take(3) | ToArray();
+ */
+[[nodiscard]] inline constexpr auto Take(int32 Count)
+{
+	return std::ranges::_Range_closure<_IGRP Take_fn, int32>{Count};
+}
+
+/**
+ * Returns the elements of a sequence as long as they satisfy a predicate; stops at the first element that doesn't.
+ *
+ * Alias for `std::views::take_while`:
+ * A range adaptor that represents view of the elements of an underlying sequence, starting at the beginning and ending
+ * at the first element for which the predicate returns false.
+ *
+ * @usage
+ * SomeNumbers | TakeWhile([](int32 N) { return N > 0; })
+ * SomeStructs | TakeWhile(&FBar::IsGood)
+ */
+template <class _Pr>
+[[nodiscard]] constexpr auto TakeWhile(_Pr&& _Pred)
+{
+	return std::views::take_while(std::forward<_Pr>(_Pred));
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Containers/Array.h"
+#include "IGRanges/AppendTo.h"
+#include "IGRanges/Reserve.h"
 #include <ranges>
 
 #include "IGRanges/Impl/Prologue.inl"
@@ -11,39 +13,61 @@ namespace IG::Ranges
 {
 namespace Private
 {
+template <typename AllocatorType>
 struct ToArray_fn
 {
-	template <typename RangeType>
-	[[nodiscard]] constexpr auto operator()(RangeType&& Range) const
+	template <typename RangeType, typename PolicyType>
+		requires std::ranges::input_range<RangeType>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range, const PolicyType& Policy) const
 	{
 		using T = std::ranges::range_value_t<RangeType>;
-		TArray<T> Array;
-
-		if constexpr (std::ranges::sized_range<RangeType>)
-		{
-			Array.Reserve(std::ranges::distance(Range));
-		}
-
-		for (auto&& X : Range)
-		{
-			Array.Emplace(X);
-		}
-
+		TArray<T, AllocatorType> Array;
+		_IGRP AppendTo_fn{}(Range, &Array, Policy);
 		return Array;
 	}
 };
 
+struct ToArrayInto_fn
+{
+	template <typename RangeType, typename ArrayType, typename PolicyType>
+	ArrayType& operator()(RangeType&& Range, ArrayType* Array, const PolicyType& Policy) const
+	{
+		// `Reset` keeps the existing allocation so that reused arrays only grow when a query yields more elements than ever before.
+		Array->Reset();
+		return _IGRP AppendTo_fn{}(Range, Array, Policy);
+	}
+};
+
 } // namespace Private
 
 /**
  * Creates a `TArray` from a range.
  *
+ * An allocator may be specified to keep small results off of the global heap (e.g. `TInlineAllocator<N>`).
+ * When using `TMemStackAllocator<>`, there must be an `FMemMark` in scope & the array must not outlive it.
+ *
  * @usage
  * TArray<int32> SquaredNumbers = SomeNumbers | Select([](int32 N) { return N * N; }) | ToArray();
+ * TArray<AActor*, TInlineAllocator<8>> SomeTargets = SomeActors | Where(&AActor::CanBeDamaged) | ToArray<TInlineAllocator<8>>();
  */
-[[nodiscard]] inline constexpr auto ToArray()
+template <typename AllocatorType = FDefaultAllocator>
+[[nodiscard]] constexpr auto ToArray()
 {
-	return std::ranges::_Range_closure<_IGRP ToArray_fn>{};
+	return std::ranges::_Range_closure<_IGRP ToArray_fn<AllocatorType>, _IGRP FReserveIfSized>{_IGRP FReserveIfSized()};
+}
+
+/**
+ * Same as `ToArray` (no parameters) but uses the specified reservation policy (`ReserveExact`, `ReserveUpperBound`,
+ * or `ReservePredicted`) to reserve space for ranges whose size is not known up front (e.g. ones that use `Where`).
+ *
+ * @usage
+ * TArray<UFoo*> Foos = SomeObjects | OfType<UFoo>() | ToArray(ReserveExact);
+ */
+template <typename AllocatorType = FDefaultAllocator, typename PolicyType>
+	requires _IGRP ReservePolicy<PolicyType>
+[[nodiscard]] constexpr auto ToArray(PolicyType Policy)
+{
+	return std::ranges::_Range_closure<_IGRP ToArray_fn<AllocatorType>, PolicyType>{std::move(Policy)};
 }
 
 /**
@@ -53,12 +77,33 @@ struct ToArray_fn
  * @usage
  * TArray<int32> SquaredNumbers = SomeNumbers | ToArray([](int32 N) { return N * N; });
  * TArray<FString> Names = SomeObjects | ToArray([](auto&& Obj) { return GetNameSafe(Obj); });
+ * TArray<FName, TInlineAllocator<4>> FewNames = FewObjects | ToArray<TInlineAllocator<4>>(&UObject::GetFName);
  */
-template <typename TransformT>
+template <typename AllocatorType = FDefaultAllocator, typename TransformT>
+	requires(!_IGRP ReservePolicy<TransformT>)
 [[nodiscard]] constexpr auto ToArray(TransformT&& Trans)
 {
 	return std::views::transform(std::forward<TransformT>(Trans))
-		 | _IGR ToArray();
+		 | _IGR ToArray<AllocatorType>();
+}
+
+/**
+ * Same as `ToArray` but fills an existing array instead of creating a new one.
+ * The array's previous elements are removed, but its allocation is kept, so an array that is reused between queries
+ * (e.g. a member that is refilled every frame) stops allocating once it has grown large enough.
+ * A reservation policy (`ReserveExact`, `ReserveUpperBound`, or `ReservePredicted`) may be specified.
+ * Returns a reference to the array.
+ *
+ * @usage
+ * const TArray<AActor*>& Targets = SomeActors | Where(&AActor::CanBeDamaged) | ToArrayInto(CachedTargets);
+ * for (APawn* Pawn : SomeActors | OfType<APawn>() | ToArrayInto(ScratchPawns, ReserveUpperBound)) { ... }
+ */
+template <typename ElementType, typename AllocatorType, typename PolicyType = _IGRP FReserveIfSized>
+	requires _IGRP ReservePolicy<PolicyType>
+[[nodiscard]] constexpr auto ToArrayInto(TArray<ElementType, AllocatorType>& Array, PolicyType Policy = {})
+{
+	using ArrayType = TArray<ElementType, AllocatorType>;
+	return std::ranges::_Range_closure<_IGRP ToArrayInto_fn, ArrayType*, PolicyType>{&Array, std::move(Policy)};
 }
 
 } // namespace IG::Ranges
@@ -0,0 +1,76 @@
+// Copyright Ian Good
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "IGRanges/Reserve.h"
+#include <functional>
+#include <ranges>
+#include <type_traits>
+
+#include "IGRanges/Impl/Prologue.inl"
+
+namespace IG::Ranges
+{
+namespace Private
+{
+struct ToMap_fn
+{
+	template <typename RangeType, typename KeySelectorType, typename ValueSelectorType>
+		requires std::invocable<KeySelectorType&, std::ranges::range_reference_t<RangeType>>
+				 && std::invocable<ValueSelectorType&, std::ranges::range_reference_t<RangeType>>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range, KeySelectorType&& KeySelector, ValueSelectorType&& ValueSelector) const
+	{
+		using ReferenceType = std::ranges::range_reference_t<RangeType>;
+		using KeyType = std::remove_cvref_t<std::invoke_result_t<KeySelectorType&, ReferenceType>>;
+		using ValueType = std::remove_cvref_t<std::invoke_result_t<ValueSelectorType&, ReferenceType>>;
+
+		TMap<KeyType, ValueType> Map;
+		if (const int64 ReserveCount = _IGRP FReserveIfSized().GetReserveCount(Range); ReserveCount > 0)
+		{
+			Map.Reserve(static_cast<int32>(ReserveCount));
+		}
+
+		for (auto&& X : Range)
+		{
+			Map.Add(std::invoke(KeySelector, X), std::invoke(ValueSelector, X));
+		}
+
+		return Map;
+	}
+};
+
+} // namespace Private
+
+/**
+ * Creates a `TMap` from a range by applying a key selector & a value selector to each element.
+ * When several elements have the same key, the last one's value is kept.
+ * The map is pre-sized for ranges whose size is known up front.
+ *
+ * @usage
+ * TMap<FName, AActor*> ActorsByName = SomeActors | ToMap(&AActor::GetFName, [](AActor* A) { return A; });
+ * TMap<int32, FString> Names = SomeStructs | ToMap(&FBar::Id, &FBar::Name);
+ */
+template <typename KeySelectorType, typename ValueSelectorType>
+[[nodiscard]] constexpr auto ToMap(KeySelectorType&& KeySelector, ValueSelectorType&& ValueSelector)
+{
+	return std::ranges::_Range_closure<_IGRP ToMap_fn, std::decay_t<KeySelectorType>, std::decay_t<ValueSelectorType>>{
+		std::forward<KeySelectorType>(KeySelector),
+		std::forward<ValueSelectorType>(ValueSelector)};
+}
+
+/**
+ * Same as `ToMap` (two parameters) but the values are the elements themselves.
+ *
+ * @usage
+ * TMap<FName, AActor*> ActorsByName = SomeActors | ToMap(&AActor::GetFName);
+ */
+template <typename KeySelectorType>
+[[nodiscard]] constexpr auto ToMap(KeySelectorType&& KeySelector)
+{
+	return _IGR ToMap(std::forward<KeySelectorType>(KeySelector), std::identity());
+}
+
+} // namespace IG::Ranges
+
+#include "IGRanges/Impl/Epilogue.inl"
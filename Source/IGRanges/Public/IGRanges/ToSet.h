@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Containers/Set.h"
+#include "IGRanges/AppendTo.h"
+#include "IGRanges/Reserve.h"
 #include <ranges>
 
 #include "IGRanges/Impl/Prologue.inl"
@@ -13,22 +15,13 @@ namespace Private
 {
 struct ToSet_fn
 {
-	template <typename RangeType>
-	[[nodiscard]] constexpr auto operator()(RangeType&& Range) const
+	template <typename RangeType, typename PolicyType>
+		requires std::ranges::input_range<RangeType>
+	[[nodiscard]] constexpr auto operator()(RangeType&& Range, const PolicyType& Policy) const
 	{
 		using T = std::ranges::range_value_t<RangeType>;
 		TSet<T> Set;
-
-		if constexpr (std::ranges::sized_range<RangeType>)
-		{
-			Set.Reserve(std::ranges::distance(Range));
-		}
-
-		for (auto&& X : Range)
-		{
-			Set.Emplace(X);
-		}
-
+		_IGRP AppendTo_fn{}(Range, &Set, Policy);
 		return Set;
 	}
 };
@@ -43,7 +36,22 @@ struct ToSet_fn
  */
 [[nodiscard]] inline constexpr auto ToSet()
 {
-	return std::ranges::_Range_closure<_IGRP ToSet_fn>{};
+	return std::ranges::_Range_closure<_IGRP ToSet_fn, _IGRP FReserveIfSized>{_IGRP FReserveIfSized()};
+}
+
+/**
+ * Same as `ToSet` (no parameters) but uses the specified reservation policy (`ReserveExact`, `ReserveUpperBound`, or
+ * `ReservePredicted`) to reserve space for ranges whose size is not known up front (e.g. ones that use `Where`).
+ * Note that reservation counts include duplicate elements.
+ *
+ * @usage
+ * TSet<UFoo*> Foos = SomeObjects | OfType<UFoo>() | ToSet(ReserveUpperBound);
+ */
+template <typename PolicyType>
+	requires _IGRP ReservePolicy<PolicyType>
+[[nodiscard]] constexpr auto ToSet(PolicyType Policy)
+{
+	return std::ranges::_Range_closure<_IGRP ToSet_fn, PolicyType>{std::move(Policy)};
 }
 
 /**
@@ -54,6 +62,7 @@ struct ToSet_fn
  * TSet<USkeletalMesh*> UniqueMeshes = MySkMeshComponents | ToSet(&USkeletalMeshComponent::GetSkeletalMeshAsset);
  */
 template <typename TransformT>
+	requires(!_IGRP ReservePolicy<TransformT>)
 [[nodiscard]] constexpr auto ToSet(TransformT&& Trans)
 {
 	return std::views::transform(std::forward<TransformT>(Trans))